@@ -0,0 +1,381 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : batch.cpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : Place all Designs of a Job Manifest
+//==================================================================
+#include "batch.hpp"
+
+using namespace Placer;
+using namespace Placer::Utils;
+
+/**
+ * @brief Constructor
+ *
+ * @param argc Command Line Arguments Counter
+ * @param argv Command Line Arguments Value
+ */
+BatchRunner::BatchRunner(int const argc, char ** argv):
+    Object(),
+    m_argc(argc),
+    m_argv(argv),
+    m_workers(1)
+{
+    nullpointer_check (argv);
+
+    m_logger = Utils::Logger::getInstance();
+    m_timer = new Utils::Timer();
+}
+
+/**
+ * @brief Destructor
+ */
+BatchRunner::~BatchRunner()
+{
+    delete m_timer; m_timer = nullptr;
+
+    Utils::Logger::destroy();
+    m_logger = nullptr;
+}
+
+/**
+ * @brief Check if the Command Line requests a Batch
+ *
+ * @param argc Command Line Arguments Counter
+ * @param argv Command Line Arguments Value
+ * @return bool
+ */
+bool BatchRunner::is_batch(int const argc, char ** argv)
+{
+    std::string option = std::string("--") + CMD_BATCH;
+
+    for (int i = 1; i < argc; ++i){
+        std::string argument(argv[i]);
+        if (argument == option || argument.rfind(option + "=", 0) == 0){
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Split the Command Line into Batch Options and Job Arguments
+ */
+void BatchRunner::read_arguments()
+{
+    namespace po = boost::program_options;
+
+    po::options_description options("Batch");
+    options.add_options()
+        (CMD_BATCH,         po::value<std::string>(),              CMD_BATCH_TEXT)
+        (CMD_BATCH_WORKERS, po::value<size_t>()->default_value(1), CMD_BATCH_WORKERS_TEXT);
+
+    po::parsed_options parsed = po::command_line_parser(m_argc, m_argv)
+                                    .options(options)
+                                    .allow_unregistered()
+                                    .run();
+    po::variables_map vm;
+    po::store(parsed, vm);
+    po::notify(vm);
+
+    m_manifest = vm[CMD_BATCH].as<std::string>();
+    m_workers = std::max<size_t>(1, vm[CMD_BATCH_WORKERS].as<size_t>());
+    m_arguments = po::collect_unrecognized(parsed.options, po::include_positional);
+}
+
+/**
+ * @brief Read all Jobs of the Manifest
+ */
+void BatchRunner::read_manifest()
+{
+    std::ifstream manifest(m_manifest);
+    if (!manifest.is_open()){
+        throw PlacerException("Can not open Batch Manifest (" + m_manifest + ")");
+    }
+
+    std::string line;
+    while (std::getline(manifest, line)){
+        size_t comment = line.find('#');
+        if (comment != std::string::npos){
+            line.erase(comment);
+        }
+
+        std::istringstream tokens(line);
+        BatchJob job;
+        if (!(tokens >> job.directory)){
+            continue;
+        }
+        // Children change into the design directory
+        job.directory = boost::filesystem::absolute(job.directory).string();
+
+        std::string token;
+        while (tokens >> token){
+            if (token.find('=') == std::string::npos){
+                throw PlacerException("Invalid Override in Batch Manifest (" + token + ")");
+            }
+            job.overrides.push_back(token);
+        }
+        m_jobs.push_back(job);
+    }
+    manifest.close();
+}
+
+/**
+ * @brief Load the LEF Libraries of all Jobs before forking
+ *
+ * The LEF file and library cache of every job are resolved like the
+ * placer does, from the command line, the overrides and its ini file.
+ * Each distinct LEF file is mapped or parsed once and registered as
+ * shared. A library failing here is left to the jobs.
+ */
+void BatchRunner::share_libraries()
+{
+    namespace po = boost::program_options;
+    namespace fs = boost::filesystem;
+
+    po::options_description options("Libraries");
+    options.add_options()
+        (CMD_LEF,       po::value<std::string>(),                              CMD_LEF_TEXT)
+        (CMD_LEF_CACHE, po::value<std::string>(),                              CMD_LEF_CACHE_TEXT)
+        (CMD_INI_FILE,  po::value<std::string>()->default_value("config.ini"), CMD_INI_FILE_TEXT);
+
+    // LEF file and library cache directory of the first job using it
+    std::map<std::string, std::string> libraries;
+    for (BatchJob const & job: m_jobs){
+        try {
+            po::variables_map vm;
+            po::store(po::command_line_parser(m_arguments).options(options).allow_unregistered().run(), vm);
+
+            std::stringstream overrides;
+            for (std::string const & itor: job.overrides){
+                overrides << itor << std::endl;
+            }
+            po::store(po::parse_config_file(overrides, options, true), vm);
+
+            this->set_ini_file(vm[CMD_INI_FILE].as<std::string>());
+            std::ifstream project_ini(fs::absolute(this->get_ini_file(), job.directory).string());
+            po::store(po::parse_config_file(project_ini, options, true), vm);
+            project_ini.close();
+            po::notify(vm);
+
+            if (!vm.count(CMD_LEF)){
+                continue;
+            }
+            std::string lef = fs::absolute(vm[CMD_LEF].as<std::string>(), job.directory).string();
+            std::string cache;
+            if (vm.count(CMD_LEF_CACHE)){
+                cache = fs::absolute(vm[CMD_LEF_CACHE].as<std::string>(), job.directory).string();
+            }
+            libraries.emplace(lef, cache);
+        } catch (std::exception const &){
+            // The job reports its own configuration error
+            continue;
+        }
+    }
+
+    size_t shared = 0;
+    for (auto const & itor: libraries){
+        if (!fs::exists(itor.first)){
+            continue;
+        }
+
+        LefLibrary* library = nullptr;
+        try {
+            this->set_lef_cache(itor.second);
+            library = new LefLibrary(itor.first);
+            nullpointer_check (library);
+
+            library->read();
+            LefLibrary::share(library);
+            shared++;
+        } catch (std::exception const & exp){
+            m_logger->batch_library_failed(itor.first, exp.what());
+            delete library; library = nullptr;
+        }
+    }
+    this->set_lef_cache("");
+
+    m_logger->batch_shared_libraries(shared);
+}
+
+/**
+ * @brief Run all Jobs
+ *
+ * @return int Zero if every Job succeeded
+ */
+int BatchRunner::run()
+{
+    try {
+        this->read_arguments();
+        this->read_manifest();
+    } catch (std::exception const & exp){
+        std::cerr << std::endl;
+        std::cerr << "### Configuration Error! ###" << std::endl;
+        std::cerr << "Description: " << exp.what() << std::endl;
+        return -1;
+    }
+    m_logger->start_batch(m_jobs.size(), m_workers);
+    this->share_libraries();
+
+    std::map<pid_t, size_t> running;
+    size_t next = 0;
+    size_t failed = 0;
+    size_t stopped = 0;
+
+    try {
+        while ((next < m_jobs.size()) || !running.empty()){
+            if ((next < m_jobs.size()) && (running.size() < m_workers)){
+                m_logger->start_batch_job(next, m_jobs[next].directory);
+                m_timer->start_timer("job_" + std::to_string(next));
+
+                // Buffered output would otherwise be written by parent and child
+                std::cout.flush();
+                std::cerr.flush();
+
+                pid_t pid = fork();
+                if (pid < 0){
+                    throw std::runtime_error("Can not fork Batch Job " + std::to_string(next));
+                } else if (pid == 0){
+                    this->run_job(next);
+                }
+                running[pid] = next++;
+                continue;
+            }
+
+            int status = 0;
+            pid_t pid = waitpid(-1, &status, 0);
+            if (pid < 0){
+                if (errno == EINTR){
+                    continue;
+                }
+                throw std::runtime_error("Lost Batch Jobs");
+            }
+
+            auto itor = running.find(pid);
+            if (itor == running.end()){
+                continue;
+            }
+            size_t id = itor->second;
+            running.erase(itor);
+
+            if (!this->finish_job(id, status)){
+                failed++;
+            }
+        }
+    } catch (std::exception const & exp){
+        m_logger->batch_aborted(exp.what(), running.size());
+        this->stop_jobs(running, failed, stopped);
+        // Jobs never started count as stopped
+        stopped += m_jobs.size() - next;
+    }
+    m_logger->batch_finished(m_jobs.size(), failed, stopped);
+
+    return ((failed == 0) && (stopped == 0)) ? 0 : 1;
+}
+
+/**
+ * @brief Report a reaped Job
+ *
+ * @param id Job ID
+ * @param status Wait Status of the Child
+ * @return bool True if the Job succeeded
+ */
+bool BatchRunner::finish_job(size_t const id, int const status)
+{
+    int code = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+
+    std::string timer = "job_" + std::to_string(id);
+    m_timer->stop_timer(timer);
+    m_logger->batch_job_finished(id, m_jobs[id].directory, code, m_timer->read_timer_ms(timer));
+
+    return code == 0;
+}
+
+/**
+ * @brief Terminate and reap all running Jobs
+ *
+ * Jobs ending on the signal of the runner count as stopped, jobs that
+ * ended on their own before are reported with their own status.
+ *
+ * @param running Running Jobs by Process ID
+ * @param failed Number of failed Jobs to increase
+ * @param stopped Number of stopped Jobs to increase
+ */
+void BatchRunner::stop_jobs(std::map<pid_t, size_t> & running, size_t & failed, size_t & stopped)
+{
+    for (auto const & itor: running){
+        kill(itor.first, SIGTERM);
+    }
+
+    for (auto const & itor: running){
+        int status = 0;
+        pid_t pid = -1;
+        do {
+            pid = waitpid(itor.first, &status, 0);
+        } while ((pid < 0) && (errno == EINTR));
+
+        std::string timer = "job_" + std::to_string(itor.second);
+        if (pid < 0){
+            m_timer->stop_timer(timer);
+            m_logger->batch_job_lost(itor.second, m_jobs[itor.second].directory);
+            failed++;
+        } else if (WIFSIGNALED(status) && (WTERMSIG(status) == SIGTERM)){
+            m_timer->stop_timer(timer);
+            m_logger->batch_job_stopped(itor.second, m_jobs[itor.second].directory,
+                                        WTERMSIG(status), m_timer->read_timer_ms(timer));
+            stopped++;
+        } else if (!this->finish_job(itor.second, status)){
+            failed++;
+        }
+    }
+    running.clear();
+}
+
+/**
+ * @brief Place the Design of a Job, runs in the forked Child
+ *
+ * @param id Job ID
+ */
+void BatchRunner::run_job(size_t const id)
+{
+    int status = 0;
+
+    try {
+        BatchJob const & job = m_jobs[id];
+        boost::filesystem::current_path(job.directory);
+
+        std::vector<std::string> arguments;
+        arguments.push_back(m_argv[0]);
+        arguments.insert(arguments.end(), m_arguments.begin(), m_arguments.end());
+
+        std::vector<char*> argv;
+        for (std::string & itor: arguments){
+            argv.push_back(&itor[0]);
+        }
+        argv.push_back(nullptr);
+
+        // Settings, Z3 context and Logger of the job start from scratch
+        PlacementContext context;
+        PlacementContext::Scope scope(&context);
+
+        MacroPlacer* placer = new MacroPlacer(arguments.size(), argv.data(), job.overrides);
+        placer->init();
+        placer->run();
+        placer->post_process();
+
+        delete placer; placer = nullptr;
+    } catch (std::exception const & exp){
+        std::cerr << "Batch Job " << id << ": " << exp.what() << std::endl;
+        status = -1;
+    }
+    std::cout.flush();
+    std::cerr.flush();
+
+    std::exit(status);
+}
@@ -0,0 +1,101 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : batch.hpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : Place all Designs of a Job Manifest
+//==================================================================
+#ifndef BATCH_HPP
+#define BATCH_HPP
+
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <boost/program_options.hpp>
+#include <boost/filesystem.hpp>
+
+#include <object.hpp>
+#include <placement_context.hpp>
+#include <cmdline_arguments.hpp>
+#include <placer.hpp>
+#include <logger.hpp>
+#include <timer.hpp>
+#include <exception.hpp>
+#include <lef_library.hpp>
+
+namespace Placer {
+
+/**
+ * @brief Design Directory and Ini File Overrides of one Job
+ */
+struct BatchJob {
+    std::string directory;
+    std::vector<std::string> overrides;
+};
+
+/**
+ * @class BatchRunner
+ *
+ * @brief Runs every job of a manifest in a forked child of one long-lived
+ *        process, up to a configurable number at a time. A child enters
+ *        the design directory and places it with its own PlacementContext,
+ *        so results land in the usual results/<id> layout. The parent
+ *        loads the LEF libraries of all jobs once before forking, the
+ *        children share them copy-on-write, while a failing job only ends
+ *        its own child. Children still running when the batch fails are
+ *        stopped and reaped before it returns.
+ *
+ * Manifest lines hold a design directory followed by ini file lines
+ * (key=value) overriding its config.ini, '#' starts a comment. All other
+ * command line arguments are passed on to every job.
+ */
+class BatchRunner: public virtual Object {
+public:
+    BatchRunner(int const argc, char ** argv);
+
+    virtual ~BatchRunner();
+
+    static bool is_batch(int const argc, char ** argv);
+
+    int run();
+
+private:
+    int m_argc;
+    char** m_argv;
+
+    std::string m_manifest;
+    size_t m_workers;
+    std::vector<std::string> m_arguments;
+    std::vector<BatchJob> m_jobs;
+
+    Utils::Logger* m_logger;
+    Utils::Timer* m_timer;
+
+    void read_arguments();
+    void read_manifest();
+    void share_libraries();
+
+    [[noreturn]] void run_job(size_t const id);
+    bool finish_job(size_t const id, int const status);
+    void stop_jobs(std::map<pid_t, size_t> & running, size_t & failed, size_t & stopped);
+};
+
+} /* namespace Placer */
+
+#endif /* BATCH_HPP */
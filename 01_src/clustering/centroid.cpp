@@ -58,8 +58,8 @@ double Centroid::eucledian_distance(Component* c)
 {
     nullpointer_check (c);
     
-    int mw = c->get_width().get_numeral_uint();
-    int mh = c->get_width().get_numeral_uint();
+    int mw = c->get_width_numeral();
+    int mh = c->get_width_numeral();
     
     int w = m_width - mw;
     int h = m_height - mh;
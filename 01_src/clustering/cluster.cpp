@@ -73,8 +73,8 @@ void Cluster::recenter()
     size_t sum_width = 0;
     
     for (Partition* p: m_partitons){
-        sum_height += p->get_height().get_numeral_uint();
-        sum_width  += p->get_width().get_numeral_uint();
+        sum_height += p->get_height_numeral();
+        sum_width  += p->get_width_numeral();
     }
     
     size_t next_width = sum_width / m_partitons.size();
@@ -80,11 +80,11 @@ void KMeans::initialize()
     m_max_width = 0;
     
     for (Component* c : m_components){
-        if (c->get_width().get_numeral_uint() > m_max_width){
-            m_max_width = c->get_width().get_numeral_uint();
+        if (c->get_width_numeral() > m_max_width){
+            m_max_width = c->get_width_numeral();
         }
-        if (c->get_height().get_numeral_uint() > m_max_height){
-            m_max_height = c->get_height().get_numeral_uint();
+        if (c->get_height_numeral() > m_max_height){
+            m_max_height = c->get_height_numeral();
         }
     }
     
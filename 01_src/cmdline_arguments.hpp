@@ -86,7 +86,25 @@ namespace Placer {
     constexpr const char CMD_Z3_SHELL[]
         = "z3-shell";
     constexpr const char CMD_Z3_SHELL_TEXT[]
-        = "Invoke Z3 Solver using Shell";
+        = "Invoke Z3 Solver using the in-process Backend Pool";
+    constexpr const char CMD_SOLVER_WORKERS[]
+        = "solver-workers";
+    constexpr const char CMD_SOLVER_WORKERS_TEXT[]
+        = "Number of concurrent Solver Configurations in the Backend Pool";
+    constexpr const char CMD_PORTFOLIO[]
+        = "portfolio";
+    constexpr const char CMD_PORTFOLIO_TEXT[]
+        = "Race Optimizer Engines and Seeds in the Backend Pool";
+
+    constexpr const char CMD_SYMMETRY_BREAKING[]
+        = "symmetry-breaking";
+    constexpr const char CMD_SYMMETRY_BREAKING_TEXT[]
+        = "Encode every Component Pair only once for Non-Overlapping";
+
+    constexpr const char CMD_INCREMENTAL[]
+        = "incremental";
+    constexpr const char CMD_INCREMENTAL_TEXT[]
+        = "Keep Base Constraints and learned Lemmas between Solutions (Z3 API only)";
 
     constexpr const char CMD_PARQUET[] 
         = "parquet";
@@ -108,6 +126,11 @@ namespace Placer {
     constexpr const char CMD_MIN_HPWL_TEXT[] 
         = "Add HPWL as Minimization Target";
 
+    constexpr const char CMD_BBOX_HPWL[]
+        = "bbox-hpwl";
+    constexpr const char CMD_BBOX_HPWL_TEXT[]
+        = "Encode HPWL as Net Bounding Boxes with a single summed Objective";
+
     constexpr const char CMD_FREE_TERMINALS[] 
         = "free-terminals";
     constexpr const char CMD_FREE_TERMINALS_TEXT[] 
@@ -122,6 +145,11 @@ namespace Placer {
     constexpr const char CMD_SKIP_PWR_SUPPLY_TEXT[] 
         = "Ignore Power Network for HPWL";
 
+    constexpr const char CMD_SKIP_CELLS[]
+        = "skip-cells";
+    constexpr const char CMD_SKIP_CELLS_TEXT[]
+        = "Keep Standard-Cells as Records, connect Macros through Cell Affinities";
+
     constexpr const char CMD_SAVE_ALL[] 
         = "save-all";
     constexpr const char CMD_SAVE_ALL_TEXT[] 
@@ -157,6 +185,16 @@ namespace Placer {
     constexpr const char CMD_STORE_DB_TEXT[]
         = "Store Results to Database";
 
+    constexpr const char CMD_ASYNC_DB[]
+        = "async-db";
+    constexpr const char CMD_ASYNC_DB_TEXT[]
+        = "Write Results to the Database from a separate Thread";
+
+    constexpr const char CMD_EXPORT_RESULTS[]
+        = "export-results";
+    constexpr const char CMD_EXPORT_RESULTS_TEXT[]
+        = "Export Results as CSV and Binary Column File";
+
     constexpr const char CMD_PARTITION[] 
         = "partition";
     constexpr const char CMD_PARTITION_TEXT[] 
@@ -171,6 +209,31 @@ namespace Placer {
         = "partition-count";
     constexpr const char CMD_PARTITION_COUNT_TEXT[] 
         ="Number of Partitions";
+
+    constexpr const char CMD_HIERARCHICAL[]
+        = "hierarchical";
+    constexpr const char CMD_HIERARCHICAL_TEXT[]
+        = "Recursive Partition and Place, Solve Leaves first and Parents bottom-up";
+
+    constexpr const char CMD_LEAF_SIZE[]
+        = "leaf-size";
+    constexpr const char CMD_LEAF_SIZE_TEXT[]
+        = "Maximum Number of Macros in a Leaf Partition";
+
+    constexpr const char CMD_FLOORPLAN_CACHE[]
+        = "floorplan-cache";
+    constexpr const char CMD_FLOORPLAN_CACHE_TEXT[]
+        = "Directory of the persistent Cache of solved Partitions";
+
+    constexpr const char CMD_SNAPSHOT_CACHE[]
+        = "snapshot-cache";
+    constexpr const char CMD_SNAPSHOT_CACHE_TEXT[]
+        = "Directory of the persistent Cache of parsed LEF/DEF Designs";
+
+    constexpr const char CMD_LEF_CACHE[]
+        = "lef-cache";
+    constexpr const char CMD_LEF_CACHE_TEXT[]
+        = "Directory of the persistent Cache of compact LEF Libraries";
     
     constexpr const char CMD_HL_IP[]
         = "hl-ip";
@@ -182,6 +245,16 @@ namespace Placer {
     constexpr const char CMD_HL_PORT_TEXT[]
         = "Port of Heuristics Lab Backend";
 
+    constexpr const char CMD_BATCH[]
+        = "batch";
+    constexpr const char CMD_BATCH_TEXT[]
+        = "Place all Designs of a Job Manifest (Design Directory and Ini Overrides per Line)";
+
+    constexpr const char CMD_BATCH_WORKERS[]
+        = "batch-workers";
+    constexpr const char CMD_BATCH_WORKERS_TEXT[]
+        = "Number of Batch Jobs running concurrently";
+
 } /* namespace Placer */
 
 #endif /* CMDLINE_ARGUMENTS */
@@ -0,0 +1,35 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : cell_definition.hpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : Compact Standard-Cell Record
+//==================================================================
+#ifndef CELL_DEFINITION_HPP
+#define CELL_DEFINITION_HPP
+
+#include <cstddef>
+
+namespace Placer {
+
+/**
+ * @brief Standard-Cell kept without a Cell object, its name is looked
+ *        up in the design snapshot on demand.
+ */
+struct CellDefinition {
+
+    CellDefinition()
+    {
+        cell = 0;
+    }
+
+    size_t cell;        ///< Index into the Cells of the Design Snapshot
+};
+
+} /* namespace Placer */
+
+#endif /* CELL_DEFINITION_HPP */
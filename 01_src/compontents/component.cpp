@@ -19,6 +19,9 @@ using namespace Placer::Utils;
  */
 Component::Component():
     m_encode(new EncodingUtils()),
+    m_geometry(Geometry::getInstance()),
+    m_solution_store(SolutionStore::getInstance()),
+    m_record(m_geometry->add_record()),
     m_lx(m_encode->get_value(0)),
     m_ly(m_encode->get_value(0)),
     m_orientation(m_encode->get_value(0)),
@@ -90,9 +93,7 @@ z3::expr& Component::get_width()
  */
 size_t Component::get_height_numeral()
 {
-    assertion_check (m_height.is_numeral());
-
-    return m_height.get_numeral_uint();
+    return m_geometry->get_height(m_record);
 }
 
 /**
@@ -102,9 +103,7 @@ size_t Component::get_height_numeral()
  */
 size_t Component::get_width_numeral()
 {
-    assertion_check(m_width.is_numeral());
-
-    return m_width.get_numeral_uint();
+    return m_geometry->get_width(m_record);
 }
 
 /**
@@ -128,33 +127,17 @@ std::string Component::get_id()
 }
 
 /**
- * @brief Add Component lx coordinate for next solution
+ * @brief Add Component Placement for next solution
  * 
  * @param lx Lx coordinate
- */
-void Component::add_solution_lx(size_t const lx)
-{
-    m_sol_lx.push_back(lx);
-}
-
-/**
- * @brief Add Component ly coordinate for next solution
- * 
  * @param ly Ly coordinate
- */
-void Component::add_solution_ly(size_t const ly)
-{
-    m_sol_ly.push_back(ly);
-}
-
-/**
- * @brief Add Component orientation for next solution
- * 
  * @param orientation Orientation of next solution
  */
-void Component::add_solution_orientation(eOrientation const orientation)
+void Component::add_solution(size_t const lx,
+                             size_t const ly,
+                             eOrientation const orientation)
 {
-    m_sol_orientation.push_back(orientation);
+    m_solution_store->add_placement(m_record, lx, ly, orientation);
 }
 
 /**
@@ -249,9 +232,7 @@ z3::expr Component::get_uy(eOrientation const orientation)
  */
 size_t Component::get_solution_ly(size_t const id)
 {
-    assertion_check(id < m_sol_ly.size());
-
-    return  m_sol_ly[id];
+    return m_solution_store->get_ly(m_record, id);
 }
 
 /**
@@ -262,9 +243,7 @@ size_t Component::get_solution_ly(size_t const id)
  */
 size_t Component::get_solution_lx(size_t const id)
 {
-    assertion_check (id < m_sol_lx.size());
-
-    return m_sol_lx[id];
+    return m_solution_store->get_lx(m_record, id);
 }
 
 /**
@@ -275,9 +254,17 @@ size_t Component::get_solution_lx(size_t const id)
  */
 eOrientation Component::get_solution_orientation(size_t const id)
 {
-    assertion_check (id < m_sol_orientation.size());
+    return m_solution_store->get_orientation(m_record, id);
+}
 
-    return m_sol_orientation[id];
+/**
+ * @brief Get Record in Geometry and SolutionStore
+ * 
+ * @return size_t
+ */
+size_t Component::get_record() const
+{
+    return m_record;
 }
 
 /**
@@ -288,10 +275,7 @@ eOrientation Component::get_solution_orientation(size_t const id)
  */
 bool Component::has_solution(size_t const id)
 {
-    assertion_check (m_sol_lx.size() == m_sol_ly.size());
-    assertion_check (m_sol_ly.size() == m_sol_orientation.size());
-
-    return (m_sol_lx.size()) > id;
+    return m_solution_store->get_num_placements(m_record) > id;
 }
 
 /**
@@ -334,13 +318,33 @@ z3::expr Component::is_E()
     return m_orientation == m_encode->get_value(eEast);
 }
 
+/**
+ * @brief Get fixed LX Coordinate
+ * 
+ * @return size_t
+ */
 size_t Component::get_lx_numeral()
 {
-    return m_lx.get_numeral_uint();
+    return m_geometry->get_lx(m_record);
 }
 
+/**
+ * @brief Get fixed LY Coordinate
+ * 
+ * @return size_t
+ */
 size_t Component::get_ly_numeral()
 {
-    return m_ly.get_numeral_uint();
+    return m_geometry->get_ly(m_record);
+}
+
+/**
+ * @brief Get fixed Orientation
+ * 
+ * @return Placer::eOrientation
+ */
+eOrientation Component::get_orientation_numeral()
+{
+    return m_geometry->get_orientation(m_record);
 }
 
@@ -16,6 +16,8 @@
 #include <encoding_utils.hpp>
 #include <exception.hpp>
 #include <pin.hpp>
+#include <geometry.hpp>
+#include <solution_store.hpp>
 
 #include <z3++.h>
 
@@ -37,6 +39,7 @@ public:
     
     size_t get_lx_numeral();
     size_t get_ly_numeral();
+    eOrientation get_orientation_numeral();
 
     z3::expr& get_lx();
     z3::expr& get_ly();
@@ -55,11 +58,12 @@ public:
     z3::expr is_S();
     z3::expr is_E();
 
+    size_t get_record() const;
     bool has_solution(size_t const id);
 
-    void add_solution_lx(size_t const lx);
-    void add_solution_ly(size_t const ly);
-    void add_solution_orientation(Placer::eOrientation const orientation);
+    void add_solution(size_t const lx,
+                      size_t const ly,
+                      Placer::eOrientation const orientation);
     
     size_t get_solution_lx(size_t const id);
     size_t get_solution_ly(size_t const id);
@@ -75,6 +79,9 @@ protected:
     Component ();
 
     EncodingUtils* m_encode;
+    Geometry* m_geometry;
+    SolutionStore* m_solution_store;
+    size_t m_record;
 
     std::string m_name;
     std::string m_id;
@@ -85,10 +92,6 @@ protected:
     z3::expr m_width;
     z3::expr m_height;
     bool m_free;
-
-    std::vector<size_t> m_sol_lx;
-    std::vector<size_t> m_sol_ly;
-    std::vector<eOrientation> m_sol_orientation;
 };
 
 } /* namespace Placer */
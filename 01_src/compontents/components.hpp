@@ -13,12 +13,15 @@
 #define COMPONENTS_HPP
 
 #include <cell.hpp>
+#include <cell_definition.hpp>
 #include <component.hpp>
+#include <geometry.hpp>
 #include <macro.hpp>
 #include <macro_definition.hpp>
 #include <partition.hpp>
 #include <pin.hpp>
 #include <pin_definition.hpp>
+#include <solution_store.hpp>
 #include <supplementmacro.hpp>
 #include <supplementpin.hpp>
 #include <terminal.hpp>
@@ -0,0 +1,315 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : geometry.cpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : Numeric Geometry of Components and Terminals
+//==================================================================
+#include "geometry.hpp"
+#include <placement_context.hpp>
+
+using namespace Placer;
+using namespace Placer::Utils;
+
+std::map<PlacementContext*, Geometry*> Geometry::p_instances;
+std::mutex Geometry::p_instance_mutex;
+
+/**
+ * @brief Get the Geometry shared by all Components and Terminals of the current Run
+ *
+ * @return Placer::Geometry*
+ */
+Geometry* Geometry::getInstance()
+{
+    std::lock_guard<std::mutex> lock(Geometry::p_instance_mutex);
+
+    Geometry*& instance = Geometry::p_instances[PlacementContext::current()];
+    if (instance == nullptr){
+        instance = new Geometry();
+    }
+
+    return instance;
+}
+
+/**
+ * @brief Release the Geometry of the current Run, all Records are dropped
+ */
+void Geometry::destroy()
+{
+    std::lock_guard<std::mutex> lock(Geometry::p_instance_mutex);
+
+    auto itor = Geometry::p_instances.find(PlacementContext::current());
+    if (itor != Geometry::p_instances.end()){
+        delete itor->second;
+        Geometry::p_instances.erase(itor);
+    }
+}
+
+/**
+ * @brief Constructor
+ */
+Geometry::Geometry()
+{
+}
+
+/**
+ * @brief Destructor
+ */
+Geometry::~Geometry()
+{
+}
+
+/**
+ * @brief Add a Record, all fields start as known zero
+ *
+ * @return size_t Record ID
+ */
+size_t Geometry::add_record()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_lx.push_back(0);
+    m_ly.push_back(0);
+    m_width.push_back(0);
+    m_height.push_back(0);
+    m_orientation.push_back(eNorth);
+    m_known.push_back(eKnownLx | eKnownLy | eKnownOrientation);
+
+    return m_lx.size() - 1;
+}
+
+/**
+ * @brief Get Number of Records
+ *
+ * @return size_t
+ */
+size_t Geometry::get_num_records() const
+{
+    return m_lx.size();
+}
+
+/**
+ * @brief Mark a Field as known or free
+ *
+ * @param record Record ID
+ * @param flag Field Flag
+ * @param known True if the Field holds a Value
+ */
+void Geometry::set_known(size_t const record, uint8_t const flag, bool const known)
+{
+    if (known){
+        m_known[record] |= flag;
+    } else {
+        m_known[record] &= ~flag;
+    }
+}
+
+/**
+ * @brief Set fixed LX Coordinate
+ *
+ * @param record Record ID
+ * @param lx Coordinate
+ */
+void Geometry::set_lx(size_t const record, size_t const lx)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    assertion_check (record < m_lx.size());
+
+    m_lx[record] = lx;
+    this->set_known(record, eKnownLx, true);
+}
+
+/**
+ * @brief Set fixed LY Coordinate
+ *
+ * @param record Record ID
+ * @param ly Coordinate
+ */
+void Geometry::set_ly(size_t const record, size_t const ly)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    assertion_check (record < m_ly.size());
+
+    m_ly[record] = ly;
+    this->set_known(record, eKnownLy, true);
+}
+
+/**
+ * @brief Set Width
+ *
+ * @param record Record ID
+ * @param width Width
+ */
+void Geometry::set_width(size_t const record, size_t const width)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    assertion_check (record < m_width.size());
+
+    m_width[record] = width;
+}
+
+/**
+ * @brief Set Height
+ *
+ * @param record Record ID
+ * @param height Height
+ */
+void Geometry::set_height(size_t const record, size_t const height)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    assertion_check (record < m_height.size());
+
+    m_height[record] = height;
+}
+
+/**
+ * @brief Set fixed Orientation
+ *
+ * @param record Record ID
+ * @param orientation Orientation
+ */
+void Geometry::set_orientation(size_t const record, eOrientation const orientation)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    assertion_check (record < m_orientation.size());
+
+    m_orientation[record] = static_cast<uint8_t>(orientation);
+    this->set_known(record, eKnownOrientation, true);
+}
+
+/**
+ * @brief Mark LX as Solver Variable
+ *
+ * @param record Record ID
+ */
+void Geometry::free_lx(size_t const record)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    assertion_check (record < m_known.size());
+
+    this->set_known(record, eKnownLx, false);
+}
+
+/**
+ * @brief Mark LY as Solver Variable
+ *
+ * @param record Record ID
+ */
+void Geometry::free_ly(size_t const record)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    assertion_check (record < m_known.size());
+
+    this->set_known(record, eKnownLy, false);
+}
+
+/**
+ * @brief Mark Orientation as Solver Variable
+ *
+ * @param record Record ID
+ */
+void Geometry::free_orientation(size_t const record)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    assertion_check (record < m_known.size());
+
+    this->set_known(record, eKnownOrientation, false);
+}
+
+/**
+ * @brief Check if LX holds a Value
+ *
+ * @param record Record ID
+ * @return bool
+ */
+bool Geometry::has_lx(size_t const record) const
+{
+    return m_known[record] & eKnownLx;
+}
+
+/**
+ * @brief Check if LY holds a Value
+ *
+ * @param record Record ID
+ * @return bool
+ */
+bool Geometry::has_ly(size_t const record) const
+{
+    return m_known[record] & eKnownLy;
+}
+
+/**
+ * @brief Check if the Orientation holds a Value
+ *
+ * @param record Record ID
+ * @return bool
+ */
+bool Geometry::has_orientation(size_t const record) const
+{
+    return m_known[record] & eKnownOrientation;
+}
+
+/**
+ * @brief Get LX Coordinate
+ *
+ * @param record Record ID
+ * @return size_t
+ */
+size_t Geometry::get_lx(size_t const record) const
+{
+    assertion_check (this->has_lx(record));
+
+    return m_lx[record];
+}
+
+/**
+ * @brief Get LY Coordinate
+ *
+ * @param record Record ID
+ * @return size_t
+ */
+size_t Geometry::get_ly(size_t const record) const
+{
+    assertion_check (this->has_ly(record));
+
+    return m_ly[record];
+}
+
+/**
+ * @brief Get Width
+ *
+ * @param record Record ID
+ * @return size_t
+ */
+size_t Geometry::get_width(size_t const record) const
+{
+    return m_width[record];
+}
+
+/**
+ * @brief Get Height
+ *
+ * @param record Record ID
+ * @return size_t
+ */
+size_t Geometry::get_height(size_t const record) const
+{
+    return m_height[record];
+}
+
+/**
+ * @brief Get Orientation
+ *
+ * @param record Record ID
+ * @return Placer::eOrientation
+ */
+eOrientation Geometry::get_orientation(size_t const record) const
+{
+    assertion_check (this->has_orientation(record));
+
+    return static_cast<eOrientation>(m_orientation[record]);
+}
@@ -0,0 +1,93 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : geometry.hpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : Numeric Geometry of Components and Terminals
+//==================================================================
+#ifndef GEOMETRY_HPP
+#define GEOMETRY_HPP
+
+#include <object.hpp>
+#include <exception.hpp>
+
+#include <vector>
+#include <map>
+#include <mutex>
+#include <cstdint>
+
+namespace Placer {
+
+/**
+ * @class Geometry
+ *
+ * @brief Plain integer view of all placeable objects. Every Component and
+ *        Terminal owns one record, the fields of all records are kept in
+ *        separate arrays. The z3 expressions of the objects are only an
+ *        overlay for the solver, everything numeric is read from here.
+ *        Solutions are kept in the SolutionStore under the same record.
+ */
+class Geometry {
+public:
+    static Geometry* getInstance();
+
+    static void destroy();
+
+    size_t add_record();
+    size_t get_num_records() const;
+
+    void set_lx(size_t const record, size_t const lx);
+    void set_ly(size_t const record, size_t const ly);
+    void set_width(size_t const record, size_t const width);
+    void set_height(size_t const record, size_t const height);
+    void set_orientation(size_t const record, eOrientation const orientation);
+
+    void free_lx(size_t const record);
+    void free_ly(size_t const record);
+    void free_orientation(size_t const record);
+
+    bool has_lx(size_t const record) const;
+    bool has_ly(size_t const record) const;
+    bool has_orientation(size_t const record) const;
+
+    size_t get_lx(size_t const record) const;
+    size_t get_ly(size_t const record) const;
+    size_t get_width(size_t const record) const;
+    size_t get_height(size_t const record) const;
+    eOrientation get_orientation(size_t const record) const;
+
+private:
+    Geometry();
+
+    virtual ~Geometry();
+
+    enum eKnown: uint8_t {
+        eKnownLx          = 1,
+        eKnownLy          = 2,
+        eKnownOrientation = 4
+    };
+
+    void set_known(size_t const record, uint8_t const flag, bool const known);
+
+    // One instance per PlacementContext
+    static std::map<PlacementContext*, Geometry*> p_instances;
+    static std::mutex p_instance_mutex;
+
+    // Guards all writes, records are added from parallel constructors
+    std::mutex m_mutex;
+
+    std::vector<size_t> m_lx;
+    std::vector<size_t> m_ly;
+    std::vector<size_t> m_width;
+    std::vector<size_t> m_height;
+    std::vector<uint8_t> m_orientation;
+    std::vector<uint8_t> m_known;
+};
+
+} /* namespace Placer */
+
+#endif /* GEOMETRY_HPP */
@@ -47,6 +47,12 @@ Macro::Macro(std::string const & name,
     m_orientation = m_encode->get_constant(id + "_orientation");
     m_logger = Logger::getInstance();
 
+    m_geometry->free_lx(m_record);
+    m_geometry->free_ly(m_record);
+    m_geometry->free_orientation(m_record);
+    m_geometry->set_width(m_record, width);
+    m_geometry->set_height(m_record, height);
+
     m_logger->add_free_macro(id,
                              width,
                              height);
@@ -90,6 +96,12 @@ Macro::Macro(std::string const & name,
     m_supplement = nullptr;
     m_logger = Logger::getInstance();
 
+    m_geometry->set_lx(m_record, pos_lx);
+    m_geometry->set_ly(m_record, pos_ly);
+    m_geometry->set_width(m_record, width);
+    m_geometry->set_height(m_record, height);
+    m_geometry->set_orientation(m_record, static_cast<eOrientation>(orientation));
+
     m_logger->add_fixed_macro(id);
 }
 
@@ -237,10 +249,7 @@ void Macro::handle_supplement()
  */
 size_t Macro::get_area()
 {
-    assertion_check (m_width.is_numeral());
-    assertion_check (m_height.is_numeral());
-    
-    return m_width.get_numeral_uint() * m_height.get_numeral_uint();
+    return this->get_width_numeral() * this->get_height_numeral();
 }
 
 /**
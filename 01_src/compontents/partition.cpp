@@ -50,6 +50,10 @@ Partition::Partition():
     m_has_value_ly = false;
     m_has_value_ux = false;
     m_has_value_uy = false;
+
+    m_geometry->free_lx(m_record);
+    m_geometry->free_ly(m_record);
+    m_geometry->free_orientation(m_record);
 }
 
 /**
@@ -187,6 +191,7 @@ void Partition::free_lx()
 {
     m_lx = m_encode->get_constant(m_lx_id);
     m_has_value_lx = false;
+    m_geometry->free_lx(m_record);
 }
 
 /**
@@ -196,6 +201,7 @@ void Partition::free_ly()
 {
     m_ly = m_encode->get_constant(m_ly_id);
     m_has_value_ly = false;
+    m_geometry->free_ly(m_record);
 }
 
 /**
@@ -225,6 +231,7 @@ void Partition::set_lx(size_t const val)
 {
     m_lx = m_encode->get_value(val);
     m_has_value_lx = true;
+    m_geometry->set_lx(m_record, val);
 }
 
 /**
@@ -236,6 +243,7 @@ void Partition::set_ly(size_t const val)
 {
     m_ly = m_encode->get_value(val);
     m_has_value_ly = true;
+    m_geometry->set_ly(m_record, val);
 }
 
 /**
@@ -268,6 +276,7 @@ void Partition::set_uy(size_t const val)
 void Partition::set_height(size_t const val)
 {
     m_height = m_encode->get_value(val);
+    m_geometry->set_height(m_record, val);
 }
 
 /**
@@ -278,6 +287,7 @@ void Partition::set_height(size_t const val)
 void Partition::set_witdh(size_t const val)
 {
     m_width = m_encode->get_value(val);
+    m_geometry->set_width(m_record, val);
 }
 
 /**
@@ -286,6 +296,7 @@ void Partition::set_witdh(size_t const val)
 void Partition::free_orientation()
 {
     m_orientation = m_encode->get_constant(m_orientation_id);
+    m_geometry->free_orientation(m_record);
 }
 
 /**
@@ -296,6 +307,7 @@ void Partition::free_orientation()
 void Partition::set_orientation(size_t const val)
 {
     m_orientation = m_encode->get_value(val);
+    m_geometry->set_orientation(m_record, static_cast<eOrientation>(val));
 }
 
 /**
@@ -388,8 +400,15 @@ std::vector<Pin*> Partition::get_pins()
 void Partition::push_up_pins()
 {
     for (Component* c: m_components){
-        for(Pin* p: c->get_pins()){
-            m_pins[c->get_id() + ":" + p->get_name()] =  p;
+        Partition* sub = dynamic_cast<Partition*>(c);
+        if (sub != nullptr){
+            // Keep the keys of nested Partitions, pin names are only unique per Macro
+            sub->push_up_pins();
+            m_pins.insert(sub->m_pins.begin(), sub->m_pins.end());
+        } else {
+            for(Pin* p: c->get_pins()){
+                m_pins[c->get_id() + ":" + p->get_name()] =  p;
+            }
         }
     }
 }
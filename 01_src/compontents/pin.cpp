@@ -28,6 +28,8 @@ Pin::Pin(std::string const & name,
          size_t const & y):
     Object(),
     m_encode(new EncodingUtils()),
+    m_solution_store(SolutionStore::getInstance()),
+    m_record(m_solution_store->add_pin_record()),
     m_pin_name(name),
     m_direction(direction),
     m_pin_pos_x(m_encode->get_value(x)),
@@ -53,6 +55,8 @@ Pin::Pin(std::string const & pin_name,
          e_pin_direction const direction):
     Object(),
     m_encode(new EncodingUtils()),
+    m_solution_store(SolutionStore::getInstance()),
+    m_record(m_solution_store->add_pin_record()),
     m_pin_name(pin_name),
     m_macro_name(macro_name),
     m_direction(direction),
@@ -306,27 +310,17 @@ size_t Pin::get_pin_pos_y_numeral()
 }
 
 /**
- * @brief Add Solution for X Coordinate
+ * @brief Add Position for the next Solution
  * 
- * @param val Coordinate
+ * @param x X Coordinate
+ * @param y Y Coordinate
  */
-void Pin::add_solution_pin_pos_x(size_t const val)
+void Pin::add_solution_pin_pos(size_t const x, size_t const y)
 {
-    m_logger->place_pin_x(m_pin_name, m_macro_name, val);
+    m_logger->place_pin_x(m_pin_name, m_macro_name, x);
+    m_logger->place_pin_y(m_pin_name, m_macro_name, y);
 
-    m_solutions_x.push_back(val);
-}
-
-/**
- * @brief Add Solution for Y Coordinate
- * 
- * @param val Coordinate
- */
-void Pin::add_solution_pin_pos_y(size_t const val)
-{
-    m_logger->place_pin_y(m_pin_name, m_macro_name, val);
-
-    m_solutions_y.push_back(val);
+    m_solution_store->add_pin_position(m_record, x, y);
 }
 
 /**
@@ -337,7 +331,7 @@ void Pin::add_solution_pin_pos_y(size_t const val)
  */
 size_t Pin::get_solution_pin_pos_x(size_t const  sol)
 {
-    return m_solutions_x[sol];
+    return m_solution_store->get_pin_x(m_record, sol);
 }
 
 /**
@@ -348,7 +342,7 @@ size_t Pin::get_solution_pin_pos_x(size_t const  sol)
  */
 size_t Pin::get_solution_pin_pos_y(size_t const sol)
 {
-    return m_solutions_y[sol];
+    return m_solution_store->get_pin_y(m_record, sol);
 }
 
 /**
@@ -449,9 +443,17 @@ bool Pin::is_free()
  */
 bool Pin::has_solution(size_t const solution_id)
 {
-    assert (m_solutions_x.size() == m_solutions_y.size());
-    
-    return m_solutions_x.size() > solution_id;
+    return m_solution_store->get_num_pin_positions(m_record) > solution_id;
+}
+
+/**
+ * @brief Get Record in SolutionStore
+ * 
+ * @return size_t
+ */
+size_t Pin::get_record() const
+{
+    return m_record;
 }
 
 /**
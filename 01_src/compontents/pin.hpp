@@ -21,6 +21,7 @@
 #include <encoding_utils.hpp>
 #include <exception.hpp>
 #include <logger.hpp>
+#include <solution_store.hpp>
 
 namespace Placer {
 
@@ -66,8 +67,7 @@ public:
     int get_offset_x_percentage();
     int get_offset_y_percentage();
 
-    void add_solution_pin_pos_x(size_t const val);
-    void add_solution_pin_pos_y(size_t const val);
+    void add_solution_pin_pos(size_t const x, size_t const y);
 
     size_t get_solution_pin_pos_x(size_t const sol);
     size_t get_solution_pin_pos_y(size_t const sol);
@@ -76,6 +76,7 @@ public:
     bool is_output();
     virtual bool is_free();
     bool has_solution(size_t const solution_id);
+    size_t get_record() const;
 
     std::string get_name();
     std::string get_id();
@@ -102,6 +103,8 @@ private:
 
     EncodingUtils* m_encode;
     Utils::Logger* m_logger;
+    SolutionStore* m_solution_store;
+    size_t m_record;
 
     std::string m_pin_name;
     std::string m_macro_name;
@@ -110,9 +113,6 @@ private:
     z3::expr m_pin_pos_x;
     z3::expr m_pin_pos_y;
 
-    std::vector<size_t> m_solutions_x;
-    std::vector<size_t> m_solutions_y;
-
     int m_offset_x_percentage;
     int m_offset_y_percentage;
     int m_offset_x;
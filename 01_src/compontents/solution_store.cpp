@@ -0,0 +1,272 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : solution_store.cpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : Columnar Storage of all Placement Solutions
+//==================================================================
+#include "solution_store.hpp"
+#include <placement_context.hpp>
+
+using namespace Placer;
+using namespace Placer::Utils;
+
+std::map<PlacementContext*, SolutionStore*> SolutionStore::p_instances;
+std::mutex SolutionStore::p_instance_mutex;
+
+/**
+ * @brief Get the Store shared by all Components, Terminals and Pins of the current Run
+ *
+ * @return Placer::SolutionStore*
+ */
+SolutionStore* SolutionStore::getInstance()
+{
+    std::lock_guard<std::mutex> lock(SolutionStore::p_instance_mutex);
+
+    SolutionStore*& instance = SolutionStore::p_instances[PlacementContext::current()];
+    if (instance == nullptr){
+        instance = new SolutionStore();
+    }
+
+    return instance;
+}
+
+/**
+ * @brief Release the Store of the current Run, all Solutions are dropped
+ */
+void SolutionStore::destroy()
+{
+    std::lock_guard<std::mutex> lock(SolutionStore::p_instance_mutex);
+
+    auto itor = SolutionStore::p_instances.find(PlacementContext::current());
+    if (itor != SolutionStore::p_instances.end()){
+        delete itor->second;
+        SolutionStore::p_instances.erase(itor);
+    }
+}
+
+/**
+ * @brief Constructor
+ */
+SolutionStore::SolutionStore()
+{
+}
+
+/**
+ * @brief Destructor
+ */
+SolutionStore::~SolutionStore()
+{
+}
+
+/**
+ * @brief Add a Pin Record
+ *
+ * @return size_t Pin Record ID
+ */
+size_t SolutionStore::add_pin_record()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_num_pin_positions.push_back(0);
+
+    return m_num_pin_positions.size() - 1;
+}
+
+/**
+ * @brief Get Column of a Solution, create it on first use
+ *
+ * @param solution Solution ID
+ * @return Placer::SolutionStore::Column&
+ */
+SolutionStore::Column& SolutionStore::get_column_for(size_t const solution)
+{
+    if (solution >= m_columns.size()){
+        m_columns.resize(solution + 1);
+    }
+
+    return m_columns[solution];
+}
+
+/**
+ * @brief Append the next Placement of a Component or Terminal
+ *
+ * @param record Geometry Record
+ * @param lx LX Coordinate
+ * @param ly LY Coordinate
+ * @param orientation Orientation
+ * @return size_t Solution ID
+ */
+size_t SolutionStore::add_placement(size_t const record,
+                                    size_t const lx,
+                                    size_t const ly,
+                                    eOrientation const orientation)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (record >= m_num_placements.size()){
+        m_num_placements.resize(record + 1, 0);
+    }
+    size_t solution = m_num_placements[record]++;
+
+    Column& column = this->get_column_for(solution);
+    if (record >= column.lx.size()){
+        column.lx.resize(m_num_placements.size(), 0);
+        column.ly.resize(m_num_placements.size(), 0);
+        column.orientation.resize(m_num_placements.size(), eNorth);
+    }
+    column.lx[record] = lx;
+    column.ly[record] = ly;
+    column.orientation[record] = static_cast<uint8_t>(orientation);
+
+    return solution;
+}
+
+/**
+ * @brief Append the next Position of a Pin
+ *
+ * @param pin Pin Record
+ * @param x X Coordinate
+ * @param y Y Coordinate
+ * @return size_t Solution ID
+ */
+size_t SolutionStore::add_pin_position(size_t const pin,
+                                       size_t const x,
+                                       size_t const y)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    assertion_check (pin < m_num_pin_positions.size());
+
+    size_t solution = m_num_pin_positions[pin]++;
+
+    Column& column = this->get_column_for(solution);
+    if (pin >= column.pin_x.size()){
+        column.pin_x.resize(m_num_pin_positions.size(), 0);
+        column.pin_y.resize(m_num_pin_positions.size(), 0);
+    }
+    column.pin_x[pin] = x;
+    column.pin_y[pin] = y;
+
+    return solution;
+}
+
+/**
+ * @brief Get Number of Columns
+ *
+ * @return size_t
+ */
+size_t SolutionStore::get_num_solutions() const
+{
+    return m_columns.size();
+}
+
+/**
+ * @brief Get Number of Placements of a Component or Terminal
+ *
+ * @param record Geometry Record
+ * @return size_t
+ */
+size_t SolutionStore::get_num_placements(size_t const record) const
+{
+    return (record < m_num_placements.size()) ? m_num_placements[record] : 0;
+}
+
+/**
+ * @brief Get Number of Positions of a Pin
+ *
+ * @param pin Pin Record
+ * @return size_t
+ */
+size_t SolutionStore::get_num_pin_positions(size_t const pin) const
+{
+    return m_num_pin_positions[pin];
+}
+
+/**
+ * @brief Get LX Coordinate of a Solution
+ *
+ * @param record Geometry Record
+ * @param solution Solution ID
+ * @return size_t
+ */
+size_t SolutionStore::get_lx(size_t const record, size_t const solution) const
+{
+    assertion_check (solution < this->get_num_placements(record));
+
+    return m_columns[solution].lx[record];
+}
+
+/**
+ * @brief Get LY Coordinate of a Solution
+ *
+ * @param record Geometry Record
+ * @param solution Solution ID
+ * @return size_t
+ */
+size_t SolutionStore::get_ly(size_t const record, size_t const solution) const
+{
+    assertion_check (solution < this->get_num_placements(record));
+
+    return m_columns[solution].ly[record];
+}
+
+/**
+ * @brief Get Orientation of a Solution
+ *
+ * @param record Geometry Record
+ * @param solution Solution ID
+ * @return Placer::eOrientation
+ */
+eOrientation SolutionStore::get_orientation(size_t const record, size_t const solution) const
+{
+    assertion_check (solution < this->get_num_placements(record));
+
+    return static_cast<eOrientation>(m_columns[solution].orientation[record]);
+}
+
+/**
+ * @brief Get Pin X Coordinate of a Solution
+ *
+ * @param pin Pin Record
+ * @param solution Solution ID
+ * @return size_t
+ */
+size_t SolutionStore::get_pin_x(size_t const pin, size_t const solution) const
+{
+    assertion_check (solution < this->get_num_pin_positions(pin));
+
+    return m_columns[solution].pin_x[pin];
+}
+
+/**
+ * @brief Get Pin Y Coordinate of a Solution
+ *
+ * @param pin Pin Record
+ * @param solution Solution ID
+ * @return size_t
+ */
+size_t SolutionStore::get_pin_y(size_t const pin, size_t const solution) const
+{
+    assertion_check (solution < this->get_num_pin_positions(pin));
+
+    return m_columns[solution].pin_y[pin];
+}
+
+/**
+ * @brief Get all Coordinates of a Solution
+ *
+ * Only records holding this Solution have a valid entry.
+ *
+ * @param solution Solution ID
+ * @return Placer::SolutionStore::Column const&
+ */
+SolutionStore::Column const & SolutionStore::get_column(size_t const solution) const
+{
+    assertion_check (solution < m_columns.size());
+
+    return m_columns[solution];
+}
@@ -0,0 +1,94 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : solution_store.hpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : Columnar Storage of all Placement Solutions
+//==================================================================
+#ifndef SOLUTION_STORE_HPP
+#define SOLUTION_STORE_HPP
+
+#include <object.hpp>
+#include <exception.hpp>
+
+#include <vector>
+#include <map>
+#include <mutex>
+#include <cstdint>
+
+namespace Placer {
+
+/**
+ * @class SolutionStore
+ *
+ * @brief Holds one column per solution. A column keeps the placement of
+ *        every Component and Terminal, indexed by its Geometry record,
+ *        and the position of every Pin, indexed by its pin record.
+ *        Reading a solution is a scan over contiguous arrays.
+ */
+class SolutionStore {
+public:
+    /**
+     * @brief All Coordinates of one Solution
+     */
+    struct Column {
+        std::vector<size_t> lx;
+        std::vector<size_t> ly;
+        std::vector<uint8_t> orientation;
+        std::vector<size_t> pin_x;
+        std::vector<size_t> pin_y;
+    };
+
+    static SolutionStore* getInstance();
+
+    static void destroy();
+
+    size_t add_pin_record();
+
+    size_t add_placement(size_t const record,
+                         size_t const lx,
+                         size_t const ly,
+                         eOrientation const orientation);
+    size_t add_pin_position(size_t const pin,
+                            size_t const x,
+                            size_t const y);
+
+    size_t get_num_solutions() const;
+    size_t get_num_placements(size_t const record) const;
+    size_t get_num_pin_positions(size_t const pin) const;
+
+    size_t get_lx(size_t const record, size_t const solution) const;
+    size_t get_ly(size_t const record, size_t const solution) const;
+    eOrientation get_orientation(size_t const record, size_t const solution) const;
+
+    size_t get_pin_x(size_t const pin, size_t const solution) const;
+    size_t get_pin_y(size_t const pin, size_t const solution) const;
+
+    Column const & get_column(size_t const solution) const;
+
+private:
+    SolutionStore();
+
+    virtual ~SolutionStore();
+
+    Column& get_column_for(size_t const solution);
+
+    // One instance per PlacementContext
+    static std::map<PlacementContext*, SolutionStore*> p_instances;
+    static std::mutex p_instance_mutex;
+
+    // Guards all writes, pin records are added from parallel constructors
+    std::mutex m_mutex;
+
+    std::vector<size_t> m_num_placements;
+    std::vector<size_t> m_num_pin_positions;
+    std::vector<Column> m_columns;
+};
+
+} /* namespace Placer */
+
+#endif /* SOLUTION_STORE_HPP */
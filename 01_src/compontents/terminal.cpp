@@ -42,6 +42,9 @@ Terminal::Terminal(std::string const & name,
     Object(),
     m_logger(Utils::Logger::getInstance()),
     m_encode(new EncodingUtils()),
+    m_geometry(Geometry::getInstance()),
+    m_solution_store(SolutionStore::getInstance()),
+    m_record(m_geometry->add_record()),
     m_name(name),
     m_free(true),
     m_key(m_key_counter++),
@@ -53,6 +56,8 @@ Terminal::Terminal(std::string const & name,
     m_free = true;
     m_bitwidth = 0;
     m_frequency = 0;
+    m_geometry->free_lx(m_record);
+    m_geometry->free_ly(m_record);
     m_logger->add_free_terminal(name);
 
     this->resolve_terminal_type();
@@ -74,6 +79,9 @@ Terminal::Terminal(std::string const & name,
     Object(),
     m_logger(Utils::Logger::getInstance()),
     m_encode(new EncodingUtils()),
+    m_geometry(Geometry::getInstance()),
+    m_solution_store(SolutionStore::getInstance()),
+    m_record(m_geometry->add_record()),
     m_name(name),
     m_free(false),
     m_key(m_key_counter++),
@@ -86,6 +94,9 @@ Terminal::Terminal(std::string const & name,
     m_free = false;
     m_bitwidth = 0;
     m_frequency = 0;
+    m_geometry->set_lx(m_record, pos_x);
+    m_geometry->set_ly(m_record, pos_y);
+    m_geometry->set_orientation(m_record, orientation);
     m_logger->add_fixed_terminal(name, pos_x, pos_y);
 
     this->resolve_terminal_type();
@@ -140,6 +151,16 @@ size_t Terminal::get_key()
     return m_key;
 }
 
+/**
+ * @brief Get Record in Geometry and SolutionStore
+ * 
+ * @return size_t
+ */
+size_t Terminal::get_record() const
+{
+    return m_record;
+}
+
 /**
  * @brief Get X Position Clause
  * 
@@ -161,23 +182,14 @@ z3::expr& Terminal::get_pos_y()
 }
 
 /**
- * @brief Add Solution for the X Value
- * 
- * @param val X-Position
- */
-void Terminal::add_solution_pos_x(size_t const val)
-{
-    m_solutions_x.push_back(val);
-}
-
-/**
- * @brief Add Solution for the Y Value
+ * @brief Add Position for the next Solution
  * 
- * @param val Y-Position
+ * @param x X-Position
+ * @param y Y-Position
  */
-void Terminal::add_solution_pos_y(size_t const val)
+void Terminal::add_solution_pos(size_t const x, size_t const y)
 {
-    m_solutions_y.push_back(val);
+    m_solution_store->add_placement(m_record, x, y, eNorth);
 }
 
 /**
@@ -188,7 +200,7 @@ void Terminal::add_solution_pos_y(size_t const val)
  */
 size_t Terminal::get_solution_pos_x(size_t const  sol)
 {
-    return m_solutions_x[sol];
+    return m_solution_store->get_lx(m_record, sol);
 }
 
 /**
@@ -199,7 +211,7 @@ size_t Terminal::get_solution_pos_x(size_t const  sol)
  */
 size_t Terminal::get_solution_pos_y(size_t const sol)
 {
-    return m_solutions_y[sol];
+    return m_solution_store->get_ly(m_record, sol);
 }
 
 /**
@@ -286,9 +298,7 @@ void Terminal::set_direction(e_pin_direction const direction)
  */
 bool Terminal::has_solution(size_t const solution)
 {
-    assertion_check (m_solutions_x.size() == m_solutions_y.size());
-
-    return solution < m_solutions_x.size();
+    return solution < m_solution_store->get_num_placements(m_record);
 }
 
 /**
@@ -395,9 +405,7 @@ bool Terminal::is_signal_terminal()
  */
 size_t Terminal::get_pos_y_numerical()
 {
-    assert (m_pos_y.is_numeral());
-
-    return m_pos_y.get_numeral_uint();
+    return m_geometry->get_ly(m_record);
 }
 
 /**
@@ -407,7 +415,5 @@ size_t Terminal::get_pos_y_numerical()
  */
 size_t Terminal::get_pox_x_numerical()
 {
-    assert (m_pos_x.is_numeral());
-
-    return m_pos_x.get_numeral_uint();
+    return m_geometry->get_lx(m_record);
 }
@@ -17,6 +17,8 @@
 #include <algorithm>
 
 #include <pin.hpp>
+#include <geometry.hpp>
+#include <solution_store.hpp>
 #include <object.hpp>
 #include <logger.hpp>
 #include <encoding_utils.hpp>
@@ -61,8 +63,7 @@ public:
     size_t get_pox_x_numerical();
     size_t get_pos_y_numerical();
 
-    void add_solution_pos_x(size_t const val);
-    void add_solution_pos_y(size_t const val);
+    void add_solution_pos(size_t const x, size_t const y);
 
     size_t get_solution_pos_x(size_t const sol);
     size_t get_solution_pos_y(size_t const sol);
@@ -70,6 +71,7 @@ public:
     std::string get_name();
     std::string get_id();
     size_t get_key();
+    size_t get_record() const;
     bool has_solution(size_t const solution);
 
     bool is_input();
@@ -92,6 +94,9 @@ public:
 private:
     Utils::Logger* m_logger;
     EncodingUtils* m_encode;
+    Geometry* m_geometry;
+    SolutionStore* m_solution_store;
+    size_t m_record;
     std::string m_name;
     bool m_free;
     size_t m_key;
@@ -105,9 +110,6 @@ private:
     z3::expr m_pos_y;
     eOrientation m_orientation;
 
-    std::vector<size_t> m_solutions_x;
-    std::vector<size_t> m_solutions_y;
-
     void resolve_terminal_type();
     static std::vector<std::string> m_terminal_keywords;
 };
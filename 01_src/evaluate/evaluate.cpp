@@ -19,10 +19,13 @@ Evaluate::Evaluate(MacroCircuit* mckt):
     m_mckt(mckt)
 {
     nullpointer_check (mckt);
+
+    m_hpwl = new HpwlEvaluator();
 }
 
 Evaluate::~Evaluate()
 {
+    delete m_hpwl; m_hpwl = nullptr;
 }
 
 /**
@@ -121,121 +124,32 @@ std::pair<size_t, size_t> Evaluate::best_area()
 /**
  * @brief Calculate the HPWL for a given Solution ID
  * 
+ * Sum of the net bounding boxes, the net index is built on first use.
+ * 
  * @param solution Solution ID
  * @return size_t
  */
 size_t Evaluate::calculate_hpwl(size_t const solution)
 {
-    Tree* tree = m_mckt->get_tree();
-    size_t hpwl = 0;
-    //std::cout << "Edges: " << tree->get_edges().size() << std::endl;
-    for(auto edge: tree->get_edges()){
-       
-        size_t from_x = 0;
-        size_t from_y = 0;
-        size_t to_x = 0;
-        size_t to_y = 0;
-        
-        Node* from = edge->get_from();
-        if(from->is_node()){
-             if(from->has_macro()){
-                Macro* m = from->get_macro();
-                nullpointer_check(m);
-                
-                Pin* pin = m->get_pin(edge->get_from_pin());
-                nullpointer_check(pin);
-                
-                if (m->is_part_of_partition()){
-                    Partition* p = m->get_parent_partition();
-                    nullpointer_check(p);
-                    
-                    from_x = p->get_solution_lx(solution) + pin->get_solution_pin_pos_x(solution);
-                    from_y = p->get_solution_ly(solution) + pin->get_solution_pin_pos_y(solution);
-                    
-                } else {
-                    if (m->is_free()){
-                        from_x = m->get_solution_lx(solution) + pin->get_solution_pin_pos_x(solution);
-                        from_y = m->get_solution_ly(solution) + pin->get_solution_pin_pos_y(solution);
-                    } else {
-                        from_x = m->get_lx_numeral()+ pin->get_solution_pin_pos_x(solution);
-                        from_y = m->get_ly_numeral() + pin->get_solution_pin_pos_y(solution);
-                    }
-                }
-                
-            
-            } else if (from->has_cell()){
-                continue;
-                notimplemented_check();
-            } else {
-                notsupported_check("Only Macros and Cells are Supported!");
-            }
-        } else if (from->is_terminal()){
-            Terminal* terminal = from->get_terminal();
-
-            if (terminal->is_free()){
-                from_x = terminal->get_solution_pos_x(solution);
-                from_y = terminal->get_solution_pos_y(solution);
-            } else {
-                from_x = terminal->get_pos_x().get_numeral_uint();
-                from_y = terminal->get_pos_y().get_numeral_uint();
-            }
-        } else {
-            notsupported_check("Only Macros and Terminals are Supported!");
-        }
-
-        Node* to = edge->get_to();
-        if(to->is_node()){
-            if(to->has_macro()){
-                Macro* m = to->get_macro();
-                nullpointer_check(m);
-                
-                Pin* pin = m->get_pin(edge->get_to_pin());
-                nullpointer_check(pin);
-                
-                if (m->is_part_of_partition()){
-                    Partition* p = m->get_parent_partition();
-                    nullpointer_check(p);
-                    
-                    to_x = p->get_solution_lx(solution) + pin->get_solution_pin_pos_x(solution);
-                    to_y = p->get_solution_ly(solution) + pin->get_solution_pin_pos_y(solution);
-                    
-                } else {
-                     if (m->is_free()){
-                        to_x = m->get_solution_lx(solution) + pin->get_solution_pin_pos_x(solution);
-                        to_y = m->get_solution_ly(solution) + pin->get_solution_pin_pos_y(solution);
-                    } else {
-                        to_x = m->get_lx_numeral()+ pin->get_solution_pin_pos_x(solution);
-                        to_y = m->get_ly_numeral() + pin->get_solution_pin_pos_y(solution);
-                    }
-                }
-            } else if (to->has_cell()){
-                continue;
-                notimplemented_check();
-            } else {
-                notsupported_check("Only Macros and Cells are Supported!");
-            }
-        } else if (to->is_terminal()){
-            Terminal* terminal = to->get_terminal();
+    if (!m_hpwl->is_built()){
+        m_hpwl->build(m_mckt->get_tree());
+    }
 
-            if (terminal->is_free()){
-                to_x = terminal->get_solution_pos_x(solution);
-                to_y = terminal->get_solution_pos_y(solution);
-            } else {
-                to_x = terminal->get_pos_x().get_numeral_uint();
-                to_y = terminal->get_pos_y().get_numeral_uint();
-            }
-        } else {
-            notsupported_check("Only Macros and Terminals are Supported!");
-        }
+    return m_hpwl->evaluate(solution);
+}
 
-        //std::cout << "From_x: " << from_x << " From_y: " << from_y << std::endl;
-        //std::cout << "To_x: " << to_x << " To_y: " << to_y << std::endl;
-        
-        hpwl += this->euclidean_distance(std::make_pair(from_x, from_y),
-                                              std::make_pair(to_x, to_y));
+/**
+ * @brief Get Access to the incremental HPWL Evaluator
+ * 
+ * @return Placer::HpwlEvaluator*
+ */
+HpwlEvaluator* Evaluate::get_hpwl_evaluator()
+{
+    if (!m_hpwl->is_built()){
+        m_hpwl->build(m_mckt->get_tree());
     }
-    //std::cout << "HPWL: " << hpwl << std::endl;
-    return hpwl;
+
+    return m_hpwl;
 }
 
 /**
@@ -275,8 +189,8 @@ size_t Evaluate::calculate_area(size_t const solution)
     Layout* layout = m_mckt->get_layout();
     //assertion_check (layout->has_solution(solution));
 
-    size_t lx = layout->get_lx().get_numeral_uint();
-    size_t ly = layout->get_ly().get_numeral_uint();
+    size_t lx = layout->get_lx_numerical();
+    size_t ly = layout->get_ly_numerical();
     size_t ux = 0;
     size_t uy = 0;
 
@@ -284,8 +198,8 @@ size_t Evaluate::calculate_area(size_t const solution)
         ux = layout->get_solution_ux(solution);
         uy = layout->get_solution_uy(solution);
     } else {
-        ux = layout->get_ux().get_numeral_uint();
-        uy = layout->get_uy().get_numeral_uint();
+        ux = layout->get_ux_numercial();
+        uy = layout->get_uy_numerical();
     }
 
     return (ux - lx) * (uy -ly);
@@ -17,6 +17,7 @@
 #include <macrocircuit.hpp>
 #include <exception.hpp>
 #include <utils.hpp>
+#include <hpwl_evaluator.hpp>
 
 #include <cmath>
 #include <algorithm>
@@ -43,10 +44,13 @@ public:
 
     void plot_hpwl_distribution();
 
+    HpwlEvaluator* get_hpwl_evaluator();
+
 private:
     friend class MacroCircuit;
 
     MacroCircuit* m_mckt;
+    HpwlEvaluator* m_hpwl;
 
     size_t calculate_hpwl(size_t const solution);
     size_t calculate_area(size_t const solution);
@@ -0,0 +1,337 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : hpwl_evaluator.cpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : Net Bounding Box HPWL with incremental Updates
+//==================================================================
+#include "hpwl_evaluator.hpp"
+
+using namespace Placer;
+using namespace Placer::Utils;
+
+/**
+ * @brief Constructor
+ */
+HpwlEvaluator::HpwlEvaluator():
+    Object()
+{
+    m_built = false;
+    m_hpwl = 0;
+    m_solution_store = SolutionStore::getInstance();
+}
+
+/**
+ * @brief Destructor
+ */
+HpwlEvaluator::~HpwlEvaluator()
+{
+}
+
+/**
+ * @brief Register the Macro or Terminal of a Node as Pin Owner
+ *
+ * @param node Tree Node
+ * @return size_t Owner Index
+ */
+size_t HpwlEvaluator::add_owner(Node* node)
+{
+    nullpointer_check (node);
+
+    if (node->is_terminal()){
+        Terminal* t = node->get_terminal();
+        nullpointer_check (t);
+
+        auto find = m_terminal_to_owner.find(t);
+        if (find != m_terminal_to_owner.end()){
+            return find->second;
+        }
+        m_owner_macro.push_back(nullptr);
+        m_owner_terminal.push_back(t);
+        m_terminal_to_owner[t] = m_owner_macro.size() - 1;
+    } else {
+        Macro* m = node->get_macro();
+        nullpointer_check (m);
+
+        auto find = m_macro_to_owner.find(m);
+        if (find != m_macro_to_owner.end()){
+            return find->second;
+        }
+        m_owner_macro.push_back(m);
+        m_owner_terminal.push_back(nullptr);
+        m_macro_to_owner[m] = m_owner_macro.size() - 1;
+    }
+
+    return m_owner_macro.size() - 1;
+}
+
+/**
+ * @brief Build the Net and Pin Index from the Connectivity Tree
+ *
+ * Cells are skipped.
+ *
+ * @param tree Connectivity Tree
+ */
+void HpwlEvaluator::build(Tree* tree)
+{
+    nullpointer_check (tree);
+
+    Hypergraph& hypergraph = tree->get_hypergraph();
+    std::vector<std::vector<size_t>> net_pins(hypergraph.get_num_nets());
+
+    for (size_t net = 0; net < hypergraph.get_num_nets(); ++net){
+        for (size_t i = hypergraph.get_net_begin(net); i < hypergraph.get_net_end(net); ++i){
+            Node* node = hypergraph.get_node(hypergraph.get_pin_node(i));
+            nullpointer_check (node);
+            if (node->is_node() && node->has_cell()){
+                continue;
+            }
+
+            size_t owner = this->add_owner(node);
+            Pin* p = nullptr;
+            if (m_owner_macro[owner] != nullptr){
+                p = m_owner_macro[owner]->get_pin(hypergraph.get_pin_name(i));
+                nullpointer_check (p);
+            }
+            net_pins[net].push_back(m_pin.size());
+            m_pin.push_back(p);
+            m_pin_owner.push_back(owner);
+            m_pin_record.push_back((p == nullptr) ? -1 : (long)p->get_record());
+        }
+    }
+
+    // Net -> Pins
+    m_net_start.assign(1, 0);
+    m_net_pins.clear();
+    for (std::vector<size_t> const & pins: net_pins){
+        m_net_pins.insert(m_net_pins.end(), pins.begin(), pins.end());
+        m_net_start.push_back(m_net_pins.size());
+    }
+    m_net_hpwl.assign(net_pins.size(), 0);
+
+    // Owner -> Pins and Owner -> Nets
+    std::vector<std::vector<size_t>> owner_pins(m_owner_macro.size());
+    for (size_t i = 0; i < m_pin.size(); ++i){
+        owner_pins[m_pin_owner[i]].push_back(i);
+    }
+    std::vector<std::vector<size_t>> owner_nets(m_owner_macro.size());
+    for (size_t net = 0; net < net_pins.size(); ++net){
+        for (size_t pin: net_pins[net]){
+            std::vector<size_t>& nets = owner_nets[m_pin_owner[pin]];
+            if (nets.empty() || nets.back() != net){
+                nets.push_back(net);
+            }
+        }
+    }
+
+    m_owner_pin_start.assign(1, 0);
+    m_owner_net_start.assign(1, 0);
+    m_owner_pins.clear();
+    m_owner_nets.clear();
+    for (size_t i = 0; i < m_owner_macro.size(); ++i){
+        m_owner_pins.insert(m_owner_pins.end(), owner_pins[i].begin(), owner_pins[i].end());
+        m_owner_pin_start.push_back(m_owner_pins.size());
+        m_owner_nets.insert(m_owner_nets.end(), owner_nets[i].begin(), owner_nets[i].end());
+        m_owner_net_start.push_back(m_owner_nets.size());
+    }
+
+    m_owner_x.assign(m_owner_macro.size(), 0);
+    m_owner_y.assign(m_owner_macro.size(), 0);
+    m_pin_dx.assign(m_pin.size(), 0);
+    m_pin_dy.assign(m_pin.size(), 0);
+    m_pin_x.assign(m_pin.size(), 0);
+    m_pin_y.assign(m_pin.size(), 0);
+
+    this->resolve_owners();
+
+    m_built = true;
+}
+
+/**
+ * @brief Resolve where each Owner takes its Position from
+ *
+ * Macros inside a Partition move with the Partition, fixed Owners keep
+ * their Position for all Solutions.
+ */
+void HpwlEvaluator::resolve_owners()
+{
+    m_owner_free.assign(m_owner_macro.size(), false);
+    m_owner_record.assign(m_owner_macro.size(), 0);
+    m_owner_fixed_x.assign(m_owner_macro.size(), 0);
+    m_owner_fixed_y.assign(m_owner_macro.size(), 0);
+
+    for (size_t i = 0; i < m_owner_macro.size(); ++i){
+        Macro* m = m_owner_macro[i];
+        Terminal* t = m_owner_terminal[i];
+
+        if (m != nullptr){
+            if (m->is_part_of_partition()){
+                Partition* p = m->get_parent_partition();
+                nullpointer_check (p);
+
+                m_owner_free[i] = true;
+                m_owner_record[i] = p->get_record();
+            } else if (m->is_free()){
+                m_owner_free[i] = true;
+                m_owner_record[i] = m->get_record();
+            } else {
+                m_owner_fixed_x[i] = m->get_lx_numeral();
+                m_owner_fixed_y[i] = m->get_ly_numeral();
+            }
+        } else if (t->is_free()){
+            m_owner_free[i] = true;
+            m_owner_record[i] = t->get_record();
+        } else {
+            m_owner_fixed_x[i] = t->get_pox_x_numerical();
+            m_owner_fixed_y[i] = t->get_pos_y_numerical();
+        }
+    }
+}
+
+/**
+ * @brief Check if the Index has been built
+ *
+ * @return bool
+ */
+bool HpwlEvaluator::is_built() const
+{
+    return m_built;
+}
+
+/**
+ * @brief Load the Coordinates of a Solution and calculate its HPWL
+ *
+ * @param solution Solution ID
+ * @return size_t
+ */
+size_t HpwlEvaluator::evaluate(size_t const solution)
+{
+    assertion_check (m_built);
+
+    for (size_t i = 0; i < m_owner_x.size(); ++i){
+        if (m_owner_free[i]){
+            m_owner_x[i] = m_solution_store->get_lx(m_owner_record[i], solution);
+            m_owner_y[i] = m_solution_store->get_ly(m_owner_record[i], solution);
+        } else {
+            m_owner_x[i] = m_owner_fixed_x[i];
+            m_owner_y[i] = m_owner_fixed_y[i];
+        }
+    }
+
+    for (size_t i = 0; i < m_pin.size(); ++i){
+        if (m_pin_record[i] >= 0){
+            m_pin_dx[i] = m_solution_store->get_pin_x(m_pin_record[i], solution);
+            m_pin_dy[i] = m_solution_store->get_pin_y(m_pin_record[i], solution);
+        }
+        m_pin_x[i] = m_owner_x[m_pin_owner[i]] + m_pin_dx[i];
+        m_pin_y[i] = m_owner_y[m_pin_owner[i]] + m_pin_dy[i];
+    }
+
+    m_hpwl = 0;
+    for (size_t net = 0; net < m_net_hpwl.size(); ++net){
+        m_hpwl += this->net_hpwl(net);
+    }
+
+    return m_hpwl;
+}
+
+/**
+ * @brief Recalculate the Bounding Box of a Net
+ *
+ * @param net Net Index
+ * @return size_t
+ */
+size_t HpwlEvaluator::net_hpwl(size_t const net)
+{
+    size_t lx = std::numeric_limits<size_t>::max();
+    size_t ly = std::numeric_limits<size_t>::max();
+    size_t ux = 0;
+    size_t uy = 0;
+
+    for (size_t i = m_net_start[net]; i < m_net_start[net + 1]; ++i){
+        size_t pin = m_net_pins[i];
+        lx = std::min(lx, m_pin_x[pin]);
+        ly = std::min(ly, m_pin_y[pin]);
+        ux = std::max(ux, m_pin_x[pin]);
+        uy = std::max(uy, m_pin_y[pin]);
+    }
+
+    m_net_hpwl[net] = (m_net_start[net + 1] - m_net_start[net] < 2) ? 0 : (ux - lx) + (uy - ly);
+
+    return m_net_hpwl[net];
+}
+
+/**
+ * @brief Get the HPWL of the loaded Coordinates
+ *
+ * @return size_t
+ */
+size_t HpwlEvaluator::get_hpwl() const
+{
+    return m_hpwl;
+}
+
+/**
+ * @brief Get Number of indexed Nets
+ *
+ * @return size_t
+ */
+size_t HpwlEvaluator::get_num_nets() const
+{
+    return m_net_hpwl.size();
+}
+
+/**
+ * @brief Get the Owner Index of a Macro
+ *
+ * @param macro Macro
+ * @return long Owner Index, -1 if the Macro has no Nets
+ */
+long HpwlEvaluator::find_owner(Macro* macro) const
+{
+    auto find = m_macro_to_owner.find(macro);
+    if (find == m_macro_to_owner.end()){
+        return -1;
+    }
+
+    return find->second;
+}
+
+/**
+ * @brief Move an Owner and update the HPWL of its Nets
+ *
+ * Pin offsets are kept, the move is a translation. Moving the owner back
+ * to its old position reverts the change.
+ *
+ * @param owner Owner Index
+ * @param x New Lower Left X
+ * @param y New Lower Left Y
+ * @return long Change of the total HPWL
+ */
+long HpwlEvaluator::move(size_t const owner, size_t const x, size_t const y)
+{
+    assertion_check (owner < m_owner_x.size());
+
+    m_owner_x[owner] = x;
+    m_owner_y[owner] = y;
+
+    for (size_t i = m_owner_pin_start[owner]; i < m_owner_pin_start[owner + 1]; ++i){
+        size_t pin = m_owner_pins[i];
+        m_pin_x[pin] = x + m_pin_dx[pin];
+        m_pin_y[pin] = y + m_pin_dy[pin];
+    }
+
+    long delta = 0;
+    for (size_t i = m_owner_net_start[owner]; i < m_owner_net_start[owner + 1]; ++i){
+        size_t net = m_owner_nets[i];
+        long old_hpwl = m_net_hpwl[net];
+        delta += (long)this->net_hpwl(net) - old_hpwl;
+    }
+    m_hpwl += delta;
+
+    return delta;
+}
@@ -0,0 +1,100 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : hpwl_evaluator.hpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : Net Bounding Box HPWL with incremental Updates
+//==================================================================
+#ifndef HPWL_EVALUATOR_HPP
+#define HPWL_EVALUATOR_HPP
+
+#include <object.hpp>
+#include <tree.hpp>
+#include <hypergraph.hpp>
+#include <macro.hpp>
+#include <terminal.hpp>
+#include <partition.hpp>
+#include <solution_store.hpp>
+#include <exception.hpp>
+
+#include <map>
+#include <vector>
+#include <string>
+#include <limits>
+#include <algorithm>
+
+namespace Placer {
+
+/**
+ * @class HpwlEvaluator
+ * @brief Half-perimeter wirelength over the nets of the connectivity tree.
+ *
+ * The net to pin index is built once as compressed rows, coordinates are
+ * kept in flat arrays. Moving a single macro only recomputes the nets
+ * attached to it.
+ */
+class HpwlEvaluator: public virtual Object {
+public:
+    HpwlEvaluator();
+
+    virtual ~HpwlEvaluator();
+
+    void build(Tree* tree);
+    bool is_built() const;
+
+    size_t evaluate(size_t const solution);
+
+    size_t get_hpwl() const;
+    size_t get_num_nets() const;
+
+    long find_owner(Macro* macro) const;
+    long move(size_t const owner, size_t const x, size_t const y);
+
+private:
+    bool m_built;
+    size_t m_hpwl;
+    SolutionStore* m_solution_store;
+
+    // Owners: Macros and Terminals carrying pins
+    std::vector<Macro*> m_owner_macro;
+    std::vector<Terminal*> m_owner_terminal;
+    std::vector<size_t> m_owner_x;
+    std::vector<size_t> m_owner_y;
+    // Free Owners read their Record from the SolutionStore
+    std::vector<bool> m_owner_free;
+    std::vector<size_t> m_owner_record;
+    std::vector<size_t> m_owner_fixed_x;
+    std::vector<size_t> m_owner_fixed_y;
+    std::map<Macro*, size_t> m_macro_to_owner;
+    std::map<Terminal*, size_t> m_terminal_to_owner;
+
+    // Pins, Offsets are relative to their Owner
+    std::vector<Pin*> m_pin;
+    std::vector<size_t> m_pin_owner;
+    std::vector<long> m_pin_record;
+    std::vector<size_t> m_pin_dx;
+    std::vector<size_t> m_pin_dy;
+    std::vector<size_t> m_pin_x;
+    std::vector<size_t> m_pin_y;
+
+    // Net -> Pins and Owner -> Pins/Nets as compressed Rows
+    std::vector<size_t> m_net_start;
+    std::vector<size_t> m_net_pins;
+    std::vector<size_t> m_net_hpwl;
+    std::vector<size_t> m_owner_pin_start;
+    std::vector<size_t> m_owner_pins;
+    std::vector<size_t> m_owner_net_start;
+    std::vector<size_t> m_owner_nets;
+
+    size_t add_owner(Node* node);
+    void resolve_owners();
+    size_t net_hpwl(size_t const net);
+};
+
+} /* namespace Placer */
+
+#endif /* HPWL_EVALUATOR_HPP */
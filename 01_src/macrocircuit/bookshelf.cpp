@@ -20,7 +20,8 @@ using namespace Placer::Utils;
 Bookshelf::Bookshelf():
     Object()
 {
-    m_tree = new Tree();
+    m_symbols = new SymbolTable();
+    m_tree = new Tree(m_symbols);
     m_logger = Logger::getInstance();
     m_design_read = false;
     m_could_duduce_layout = false;
@@ -32,6 +33,7 @@ Bookshelf::Bookshelf():
 Bookshelf::~Bookshelf()
 {
     m_tree = nullptr;
+    m_symbols = nullptr;
     m_logger = nullptr;
 }
 
@@ -109,67 +111,62 @@ void Bookshelf::read_blocks()
         throw PlacerException("Can not open blocks file (" + m_blocks_file + ")");
     }
 
-    std::ifstream blocks_stream(m_blocks_file);
-    std::vector<std::string> blocks_content;
-    std::string line;
-
-    while(std::getline(blocks_stream, line)){
-        blocks_content.push_back(line);
-    }
-    blocks_stream.close();
+    MappedFile blocks_file(m_blocks_file);
+    std::string_view line;
+    std::vector<std::string_view> token;
+    std::vector<std::string_view> macro_token;
 
-    if(blocks_content[0] != "UCSC blocks 1.0"){
+    if(!blocks_file.next_line(line) || line != "UCSC blocks 1.0"){
         throw PlacerException("Bookshelf Blocks Header invalid!");
     }
 
-    for(auto line : blocks_content){
+    while(blocks_file.next_line(line)){
         if(line.empty()){
             continue;
         }
 
-        std::vector<std::string> token = Utils::Utils::tokenize(line, " ");
+        Utils::Utils::tokenize(line, " \t", token);
 
-        if(line[0] == '#'){
+        if(line[0] == '#' || token.empty()){
             continue;
 
-        } else if((token[0].compare("UCSC") == 0)){
+        } else if(token[0] == "UCSC"){
             continue;
 
         }   else if(token[0] == "NumSoftRectangularBlocks"){
             continue;
 
         } else if (token[0] == "NumHardRectilinearBlocks"){
-            m_expected_macros = std::stoi(token[2]);
+            assertion_check (token.size() > 2);
+            m_expected_macros = Utils::Utils::to_size(token[2]);
 
         } else if(token[0] == "NumTerminals"){
-            m_excepted_terminals = std::stoi(token[2]);
-
-        } else if (token[1] == "hardrectilinear"){
-            std::string name = token[0];
+            assertion_check (token.size() > 2);
+            m_excepted_terminals = Utils::Utils::to_size(token[2]);
 
-            std::vector<std::string> macro_token = Utils::Utils::tokenize(line, "(");
+        } else if (token.size() > 1 && token[1] == "hardrectilinear"){
+            Utils::Utils::tokenize(line, "(", macro_token);
             assertion_check (macro_token.size() == 5);
-            std::string expr = macro_token[3];
+            std::string_view expr = macro_token[3];
 
             size_t comma_pos = expr.find(',');
-            size_t height = std::stoi(expr.substr(0, comma_pos));
-            size_t width = std::stoi(expr.substr(comma_pos+1, expr.length()));
+            assertion_check (comma_pos != std::string_view::npos);
 
             MacroDefinition macro_def;
-            macro_def.width = width;
-            macro_def.height = height;
-            macro_def.name = name;
+            macro_def.height = Utils::Utils::to_size(expr.substr(0, comma_pos));
+            macro_def.width = Utils::Utils::to_size(expr.substr(comma_pos + 1));
+            macro_def.name = std::string(token[0]);
             m_macro_definitions.push_back(macro_def);
 
-        } else if (token[1] == "terminal"){
+        } else if (token.size() > 1 && token[1] == "terminal"){
             TerminalDefinition terminal_definition;
-            terminal_definition.name = token[0];
+            terminal_definition.name = std::string(token[0]);
             terminal_definition.pos_x = 0;
             terminal_definition.pos_y = 0;
             m_terminal_definitions.push_back(terminal_definition);
 
         } else {
-            notsupported_check(line);
+            notsupported_check(std::string(line));
         }
     }
 
@@ -187,6 +184,9 @@ void Bookshelf::read_blocks()
 
 /**
  * @brief Read Bookshelf Nets File
+ * 
+ * The file is parsed in a single pass, every net is handed to the tree
+ * as soon as the next NetDegree statement or the end of file is reached.
  */
 void Bookshelf::read_nets()
 {
@@ -196,168 +196,122 @@ void Bookshelf::read_nets()
         throw PlacerException("Can not open nets file (" + m_nets_file + ")");
     }
 
-    std::ifstream nets_stream(m_nets_file);
-    std::vector<std::string> nets_content;
-    std::string line;
-    
-    size_t num_nets = 0;
-    size_t num_pins = 0;
-    
-    while(std::getline(nets_stream, line)){
-        nets_content.push_back(line);
-    }
-    nets_stream.close();
-    
-    if(nets_content[0] != "UCLA nets 1.0"){
+    MappedFile nets_file(m_nets_file);
+    std::string_view line;
+    std::vector<std::string_view> token;
+
+    if(!nets_file.next_line(line) || line != "UCLA nets 1.0"){
         throw PlacerException("Bookshelf Nets Header invalid!");
     }
-    
-    for(size_t i = 0; i < nets_content.size(); ++i){
-        // Empty Line
-        if (nets_content[i].size () == 0){
-            continue;
-        }
-        
-        std::vector<std::string> token = Utils::Utils::tokenize(nets_content[i], " ");
-        
-        // Comment
-        if (token[0] == "#"){
-            continue;
-        // NumNets : 42
-        } else if (token[0] == "NumNets"){
-            assertion_check (token[1] == ":");
-            num_nets = std::stoi(token[2]);
-        // NumPins : 42
-        } else if (token[0] == "NumPins"){
-            assertion_check (token[1] == ":");
-            num_pins = std::stoi(token[2]);
-        } else if (token[0] == "NetDegree"){
-            num_nets++;
-
-            assertion_check (token[1] == ":");
-            size_t sub_net_degree = std::stoi(token[2]);
-            size_t j = i+1;
-            std::vector<Node*> nodes;
-            std::vector<std::string> pins;
-            for(; j < nets_content.size(); ++j){
-                std::vector<std::string> sub_token = Utils::Utils::tokenize(nets_content[j], " ");
-
-                if (sub_token[0] == "NetDegree"){
-                    assertion_check (sub_net_degree == nodes.size());
-                    break;
-                }
 
-                // Comment
-                if (sub_token[0] == "#"){
-                    continue;
-                }
+    size_t expected_nets = 0;
+    size_t expected_pins = 0;
+    size_t num_nets = 0;
+    size_t num_pins = 0;
 
-                std::string id = sub_token[0];
-                if (this->has_macro(id)){
-                    std::string direction = sub_token[1];
-                    // Pin has relative position
-                    if (!this->get_minimize_die_mode()){
-                        if (sub_token.size() > 2) {
-                            assertion_check (sub_token[2] == ":");
-                            std::string rel_pos_x = sub_token[3];
-                            std::string rel_pos_y = sub_token[4];
-                            std::string pin = rel_pos_x + "_" + rel_pos_y;
-                            this->add_pin_to_macro(id, pin, direction, rel_pos_x, rel_pos_y);
-                            pins.push_back(pin);
-                        // Pin is free
-                        } else {
-                            std::string pin =  "%0.0_%0.0";
-                            this->add_pin_to_macro(id, pin, direction, "", "");
-                            pins.push_back(pin);
-                        }
-                    }
-                    Node* n = new Node(this->find_macro(id));
-                    nodes.push_back(n);
-                    num_pins++;
-
-                } else if (this->has_terminal(id)){
-                    Node* n = new Node(this->find_terminal(id));
-                    nodes.push_back(n);
-                    pins.push_back(id);
-                    
-                } else {
-                    notsupported_check("Only Terminals and Macros are allowed!");
+    // Pins of the currently open Net
+    bool net_open = false;
+    size_t net_degree = 0;
+    std::vector<Macro*> macros;
+    std::vector<Terminal*> terminals;
+    std::vector<std::string> pins;
+    std::string id;
+
+    auto close_net = [&](){
+        if (!net_open){
+            return;
+        }
+        assertion_check (net_degree == pins.size());
+        assertion_check (pins.size() >= 2);
+
+        num_nets++;
+        num_pins += pins.size();
+
+        size_t net = m_tree->insert_net("");
+        for(size_t i = 0; i < pins.size(); ++i){
+            if (macros[i] != nullptr){
+                m_tree->insert_pin<Macro>(net, macros[i], pins[i]);
+            } else if (terminals[i] != nullptr){
+                if (!(this->get_skip_power_network() && terminals[i]->is_power_terminal())){
+                    m_tree->insert_pin<Terminal>(net, terminals[i], pins[i]);
                 }
-            }
-            // Sub-State Machine ended -continue global
-            i = j-1;
-
-            assertion_check (nodes.size() >= 2);
-            char from_case = 0;
-            if (nodes[0]->is_terminal()){
-                from_case = 't';
-            } else if (nodes[0]->has_macro()){
-                from_case = 'm';
-            } else if (nodes[0]->has_cell()){
-                from_case = 'c';
             } else {
                 notimplemented_check();
             }
+        }
 
-            for(size_t node_index = 1; node_index < nodes.size(); ++node_index){
-                char to_case = 0;
-                if (nodes[node_index]->is_terminal()){
-                    to_case = 't';
-                } else if (nodes[node_index]->has_macro()){
-                    to_case = 'm';
-                } else if (nodes[node_index]->has_cell()){
-                    to_case = 'c';
-                } else {
-                    notimplemented_check();
-                }
-                std::string from_pin;
-                std::string to_pin;
-                if (this->get_minimize_die_mode()){
-                    from_pin  = "center";
-                    to_pin = "center";
-                } else {
-                    from_pin  = pins[0];
-                    to_pin = pins[node_index];
-                }
-
-                if (from_case == 'm' && to_case == 'm'){
-                    Macro* from = nodes[0]->get_macro();
-                    nullpointer_check(from);
-
-                    Macro* to = nodes[node_index]->get_macro();
-                    nullpointer_check(to);
+        macros.clear();
+        terminals.clear();
+        pins.clear();
+        net_open = false;
+    };
 
-                    m_tree->insert_edge<Macro, Macro>(from, to, from_pin, to_pin, "");
-                } else if (from_case == 't' && to_case == 'm'){
-                    Terminal* from = nodes[0]->get_terminal();
-                    nullpointer_check(from);
+    while(nets_file.next_line(line)){
+        Utils::Utils::tokenize(line, " \t", token);
 
-                    Macro* to = nodes[node_index]->get_macro();
-                    nullpointer_check(to);
+        // Empty Line or Comment
+        if (token.empty() || token[0][0] == '#'){
+            continue;
+        // NumNets : 42
+        } else if (token[0] == "NumNets"){
+            assertion_check (token.size() > 2 && token[1] == ":");
+            expected_nets = Utils::Utils::to_size(token[2]);
+        // NumPins : 42
+        } else if (token[0] == "NumPins"){
+            assertion_check (token.size() > 2 && token[1] == ":");
+            expected_pins = Utils::Utils::to_size(token[2]);
+        } else if (token[0] == "NetDegree"){
+            close_net();
 
-                    if (!(this->get_skip_power_network() && from->is_power_terminal())){
-                        m_tree->insert_edge<Terminal, Macro>(from, to, from_pin, to_pin, "");
-                    }
-                } else if (from_case == 'm' && to_case == 't'){
-                    Macro* from = nodes[0]->get_macro();
-                    nullpointer_check(from);
+            assertion_check (token.size() > 2 && token[1] == ":");
+            net_degree = Utils::Utils::to_size(token[2]);
+            net_open = true;
+        } else if (net_open){
+            id.assign(token[0]);
 
-                    Terminal* to = nodes[node_index]->get_terminal();
-                    nullpointer_check(to);
+            Macro* m = m_symbols->find_macro(id);
+            Terminal* t = (m == nullptr) ? m_symbols->find_terminal(id) : nullptr;
 
-                    if (!(this->get_skip_power_network() && to->is_power_terminal())){
-                        m_tree->insert_edge<Macro, Terminal>(from, to, from_pin, to_pin, "");
-                    }
+            if (m != nullptr){
+                assertion_check (token.size() > 1);
+                std::string direction(token[1]);
+                // Pins are not collected in Minimize Die Mode
+                if (this->get_minimize_die_mode()){
+                    pins.push_back("center");
+                // Pin has relative position
+                } else if (token.size() > 2) {
+                    assertion_check (token.size() > 4 && token[2] == ":");
+                    std::string rel_pos_x(token[3]);
+                    std::string rel_pos_y(token[4]);
+                    std::string pin = rel_pos_x + "_" + rel_pos_y;
+                    this->add_pin_to_macro(id, pin, direction, rel_pos_x, rel_pos_y);
+                    pins.push_back(pin);
+                // Pin is free
                 } else {
-                    notimplemented_check();
+                    std::string pin =  "%0.0_%0.0";
+                    this->add_pin_to_macro(id, pin, direction, "", "");
+                    pins.push_back(pin);
                 }
+            } else if (t != nullptr){
+                pins.push_back(this->get_minimize_die_mode() ? "center" : id);
+            } else {
+                notsupported_check("Only Terminals and Macros are allowed!");
             }
-
-            for(auto itor: nodes){
-                delete itor; itor = nullptr;
-            }
+            macros.push_back(m);
+            terminals.push_back(t);
         }
     }
+    close_net();
+
+    if(expected_nets != num_nets){
+        throw PlacerException("Invalid Number of Nets Specified in Nets File!");
+    }
+
+    // Truncated Nets already fail the NetDegree check, some published
+    // benchmarks (ami33) state a wrong NumPins
+    if(expected_pins != num_pins){
+        m_logger->bookshelf_pin_mismatch(expected_pins, num_pins);
+    }
 }
 
 /**
@@ -371,51 +325,60 @@ void Bookshelf::read_pl()
         throw PlacerException("Can not open place file (" + m_pl_file + ")");
     }
 
-    std::ifstream place_stream(m_pl_file);
-    std::vector<std::string> place_content;
-    std::string line;
+    MappedFile place_file(m_pl_file);
+    std::string_view line;
+    std::vector<std::string_view> token;
+    std::string name;
 
-    std::vector<std::string> processed_terminals;
-    std::vector<std::string> processed_macros;
+    size_t processed_terminals = 0;
+    size_t processed_macros = 0;
 
     this->calc_estimated_die_area();
 
-    while(std::getline(place_stream, line)){
-        place_content.push_back(line);
+    // Definitions by Name, the first Definition of a Name wins
+    std::unordered_map<std::string, size_t> macro_index;
+    std::unordered_map<std::string, size_t> terminal_index;
+    for (size_t i = 0; i < m_macro_definitions.size(); ++i){
+        macro_index.emplace(m_macro_definitions[i].name, i);
+    }
+    for (size_t i = 0; i < m_terminal_definitions.size(); ++i){
+        terminal_index.emplace(m_terminal_definitions[i].name, i);
     }
-    place_stream.close();
 
-    for(auto& line : place_content){
+    while(place_file.next_line(line)){
         if(line.empty()){
             continue;
         }
 
-        std::vector<std::string> token = Utils::Utils::tokenize(line, " ");
+        Utils::Utils::tokenize(line, " \t", token);
 
-        if(line[0] == '#'){
+        if(line[0] == '#' || token.empty()){
             continue;
-        } else if((token[0].compare("UCLA") == 0)){
+        } else if(token[0] == "UCLA"){
             continue;
-        } else if ((token[0].compare("UCSC") == 0)){
+        } else if (token[0] == "UCSC"){
             continue;
         }
 
-        auto macro = std::find_if(m_macro_definitions.begin(), m_macro_definitions.end(), 
-                    [token](MacroDefinition const & def)
-                    {
-                        return def.name == token[0];
-                    });
+        name.assign(token[0]);
+
+        auto macro = m_macro_definitions.end();
+        auto find_macro = macro_index.find(name);
+        if (find_macro != macro_index.end()){
+            macro = m_macro_definitions.begin() + find_macro->second;
+        }
 
-        auto terminal = std::find_if(m_terminal_definitions.begin(), m_terminal_definitions.end(),
-                    [token](TerminalDefinition const & def)
-                    {
-                        return token[0] == def.name;
-                    });
+        auto terminal = m_terminal_definitions.end();
+        auto find_terminal = terminal_index.find(name);
+        if (find_terminal != terminal_index.end()){
+            terminal = m_terminal_definitions.begin() + find_terminal->second;
+        }
 
         if(macro != m_macro_definitions.end()){
-            size_t x = std::stoi(token[1]);
-            size_t y = std::stoi(token[2]);
-            processed_macros.push_back(macro->name);
+            assertion_check (token.size() > 2);
+            size_t x = Utils::Utils::to_size(token[1]);
+            size_t y = Utils::Utils::to_size(token[2]);
+            processed_macros++;
 
             // Placed Macro
             if(this->get_minimize_die_mode()) {
@@ -425,6 +388,7 @@ void Bookshelf::read_pl()
                                      macro->height);
                 nullpointer_check(m);
                 m_macros.push_back(m);
+                m_symbols->add_macro(m);
                 
                 Pin* p = new Pin("center", macro->name, eBidirectional);
                 nullpointer_check(p);
@@ -439,6 +403,7 @@ void Bookshelf::read_pl()
                                             y,
                                             0);
                m_macros.push_back(m);
+               m_symbols->add_macro(m);
 
             // Free Macro
             } else {
@@ -448,6 +413,7 @@ void Bookshelf::read_pl()
                                      macro->height);
                 nullpointer_check(m);
                 m_macros.push_back(m);
+                m_symbols->add_macro(m);
 
                 if (this->get_minimize_die_mode()){
                     Pin* p = new Pin("center", macro->name, eBidirectional);
@@ -457,28 +423,29 @@ void Bookshelf::read_pl()
             }
 
         } else if(terminal != m_terminal_definitions.end()){
-            std::string name = token[0];
-            processed_terminals.push_back(name);
+            processed_terminals++;
 
             if ((token.size() == 3) && !this->get_free_terminals()){
-                size_t x = std::stoi(token[1]);
-                size_t y = std::stoi(token[2]);
+                size_t x = Utils::Utils::to_size(token[1]);
+                size_t y = Utils::Utils::to_size(token[2]);
 
                 Terminal* tmp = new Terminal(name, x, y, e_pin_direction::eUnknown, eNorth);
                 m_terminals.push_back(tmp);
+                m_symbols->add_terminal(tmp);
             } else {
                Terminal* tmp = new Terminal(name, e_pin_direction::eUnknown);
                 m_terminals.push_back(tmp);
+                m_symbols->add_terminal(tmp);
             }
         } else {
-            notsupported_check(line);
+            notsupported_check(std::string(line));
         }
     }
 
-    if(processed_macros.size() < m_expected_macros){
+    if(processed_macros < m_expected_macros){
         throw PlacerException("Not all Macros have been processed!");
     }
-    if (processed_terminals.size() < m_excepted_terminals){
+    if (processed_terminals < m_excepted_terminals){
         throw PlacerException("Not all Terminals have been processed!");
     }
 }
@@ -502,6 +469,9 @@ void Bookshelf::set_macros(std::vector<Macro *>& macros)
 {
     m_macros.clear();
     std::copy(macros.begin(), macros.end(), std::back_inserter(m_macros));
+    for (Macro* m: m_macros){
+        m_symbols->add_macro(m);
+    }
 }
 
 /**
@@ -523,6 +493,10 @@ void Bookshelf::set_terminals(std::vector<Terminal *>& terminals)
 {
     m_terminals.clear();
     std::copy(terminals.begin(), terminals.end(), std::back_inserter(m_terminals));
+    m_symbols->remove_terminals();
+    for (Terminal* t: m_terminals){
+        m_symbols->add_terminal(t);
+    }
 }
 
 /**
@@ -535,6 +509,16 @@ Tree* Bookshelf::get_tree()
     return m_tree;
 }
 
+/**
+ * @brief Get the Symbol Table of the read Design
+ *
+ * @return Placer::SymbolTable*
+ */
+SymbolTable* Bookshelf::get_symbol_table()
+{
+    return m_symbols;
+}
+
 /**
  * @brief Set Tree for results export
  * 
@@ -590,15 +574,8 @@ std::string Bookshelf::get_design_name () const
  */
 Macro* Bookshelf::find_macro(std::string const & name)
 {
-    Macro* ret_val = nullptr;
-    for (auto itor: m_macros){
-        if (itor->get_name() == name){
-            ret_val = itor;
-            break;
-        }
-    }
-    assert (ret_val != nullptr);
-    assert (name == ret_val->get_id());
+    Macro* ret_val = m_symbols->find_macro(name);
+    nullpointer_check (ret_val);
     
     return ret_val;
 }
@@ -611,16 +588,7 @@ Macro* Bookshelf::find_macro(std::string const & name)
  */
 bool Bookshelf::has_macro(std::string const & name)
 {
-    Macro* ret_val = nullptr;
-
-    for (auto itor: m_macros){
-        if (itor->get_name() == name){
-            ret_val = itor;
-            break;
-        }
-    }
-
-    return ret_val != nullptr;
+    return m_symbols->find_macro(name) != nullptr;
 }
 
 /**
@@ -631,16 +599,8 @@ bool Bookshelf::has_macro(std::string const & name)
  */
 Terminal* Bookshelf::find_terminal(std::string const & name)
 {
-    Terminal* ret_val = nullptr;
-
-    for (auto itor: m_terminals){
-        if (itor->get_name() == name){
-            ret_val = itor;
-            break;
-        }
-    }
-
-    assertion_check(name == ret_val->get_name());
+    Terminal* ret_val = m_symbols->find_terminal(name);
+    nullpointer_check (ret_val);
 
     return ret_val;
 }
@@ -653,15 +613,7 @@ Terminal* Bookshelf::find_terminal(std::string const & name)
  */
 bool Bookshelf::has_terminal(std::string const & name)
 {
-    Terminal* ret_val = nullptr;
-
-    for (auto itor: m_terminals){
-        if (itor->get_name() == name){
-            ret_val = itor;
-            break;
-        }
-    }
-    return ret_val != nullptr;
+    return m_symbols->find_terminal(name) != nullptr;
 }
 
 /**
@@ -793,9 +745,9 @@ void Bookshelf::write_blocks()
         }
        
         feed << "(0, 0) ";
-        feed << "(0, " << curMacro->get_width().get_numeral_uint() << ") ";
-        feed << "(" << curMacro->get_height().get_numeral_uint() << ", " << curMacro->get_width().get_numeral_uint() << ") ";
-        feed << "(" << curMacro->get_height().get_numeral_uint() << ",0) " << std::endl;
+        feed << "(0, " << curMacro->get_width_numeral() << ") ";
+        feed << "(" << curMacro->get_height_numeral() << ", " << curMacro->get_width_numeral() << ") ";
+        feed << "(" << curMacro->get_height_numeral() << ",0) " << std::endl;
     }
     feed << std::endl;
 
@@ -826,12 +778,15 @@ void Bookshelf::write_nets()
     } else {
            std::ofstream netsFile(filename);
 
-        auto steiner_tree = m_tree->get_steiner_tree();
+        Hypergraph& hypergraph = m_tree->get_hypergraph();
 
+        size_t net_cnt = 0;
         size_t pin_cnt = 0;
-        for (auto itor: steiner_tree){
-            pin_cnt += itor.second.size();
-            pin_cnt++;
+        for (size_t net = 0; net < hypergraph.get_num_nets(); ++net){
+            if (hypergraph.get_net_degree(net) > 1){
+                net_cnt++;
+                pin_cnt += hypergraph.get_net_degree(net);
+            }
         }
 
         std::stringstream feed;
@@ -841,86 +796,48 @@ void Bookshelf::write_nets()
         feed << "# Platform " << Utils::Utils::get_plattform() << std::endl;
         feed << "# Exported by SMT_MacroPlacer" << std::endl;
         feed << std::endl;
-        feed << "NumNets : " << steiner_tree.size() << std::endl;
+        feed << "NumNets : " << net_cnt << std::endl;
         feed << "NumPins : "  << pin_cnt << std::endl;
         feed << std::endl;
 
-        for(auto itor: steiner_tree){
-            size_t netdegree = itor.second.size() + 1;
-            feed << "NetDegree : " << netdegree << std::endl;
-
-            std::vector<std::string> token = Utils::Utils::tokenize(itor.first, ":");
-            assertion_check (token.size() == 2);
-            // Terminal
-            std::cout << token[0] << " " << token[1] << std::endl;
-
-            if (this->has_terminal(token[0])){
-                Terminal* t = this->find_terminal(token[0]);
-                nullpointer_check(t)
-                //feed << "# " << t->get_name() << std::endl;
-                if (this->check_name_dac2002(t->get_name())){
-                    feed << t->get_name() << " B" << std::endl;
-                } else {
-                    feed << "o" <<  t->get_key() << " B" << std::endl;
-                }
-                feed << "# The above terminal is a pad" << std::endl;
-            } else {
-                std::vector<std::string> token2 = Utils::Utils::tokenize(token[1], "_");
-                Macro* m = this->find_macro(token[0]);
-                nullpointer_check(m);
-                size_t width = m->get_width_numeral();
-                size_t height = m->get_height_numeral();
-                
-                double factor_width = 0.0;
-                double factor_height = 0.0;
-                if (this->get_minimize_die_mode()){
-                    factor_width = 0.5;
-                    factor_height = 0.5;
-                } else {
-                    factor_width = (std::stoi(token2[0].substr(1, token2[0].size()))/100.0);
-                    factor_height = (std::stoi(token2[1].substr(1, token2[1].size()))/100.0);
-                }
-            
-                //feed << "# " << m->get_id() << std::endl;
-                if (this->check_name_dac2002(m->get_id())){
-                    feed << m->get_id() << " B : " << width * factor_width << " " << height * factor_height << std::endl;
-                } else {
-                    feed << "o" << m->get_key() << " B : " << width * factor_width << " " << height * factor_height << std::endl;
-                }
+        for (size_t net = 0; net < hypergraph.get_num_nets(); ++net){
+            if (hypergraph.get_net_degree(net) < 2){
+                continue;
             }
+            feed << "NetDegree : " << hypergraph.get_net_degree(net) << std::endl;
+
+            for (size_t i = hypergraph.get_net_begin(net); i < hypergraph.get_net_end(net); ++i){
+                Node* node = hypergraph.get_node(hypergraph.get_pin_node(i));
+                nullpointer_check(node);
 
-            for(auto itor2: itor.second){
-                std::vector<std::string> token = Utils::Utils::tokenize(itor2, ":");
-                assertion_check (token.size() == 2);
-                // Terminal
-                std::cout << token[0] << " " << token[1] << std::endl;
-                if (token[0] == token[1]){
-                    Terminal* t = this->find_terminal(token[0]);
+                if (node->is_terminal()){
+                    Terminal* t = node->get_terminal();
                     nullpointer_check(t);
-                    //feed << "# " << t->get_name() << std::endl;
                     if (this->check_name_dac2002(t->get_name())){
                         feed << t->get_name() << " B" << std::endl;
                     } else {
                         feed << "o" <<  t->get_key() << " B" << std::endl;
                     }
+                    if (i == hypergraph.get_net_begin(net)){
+                        feed << "# The above terminal is a pad" << std::endl;
+                    }
                 } else {
-                    std::vector<std::string> token2 = Utils::Utils::tokenize(token[1], "_");
-                    Macro* m = this->find_macro(token[0]);
+                    Macro* m = node->get_macro();
                     nullpointer_check(m);
-                    size_t width = m->get_width().get_numeral_uint();
-                    size_t height = m->get_height().get_numeral_uint();
-                    
+                    size_t width = m->get_width_numeral();
+                    size_t height = m->get_height_numeral();
+
                     double factor_width = 0.0;
                     double factor_height = 0.0;
                     if (this->get_minimize_die_mode()){
                         factor_width = 0.5;
                         factor_height = 0.5;
                     } else {
-                        factor_width = (std::stoi(token2[0].substr(1, token2[0].size()))/100.0);
-                        factor_height = (std::stoi(token2[1].substr(1, token2[1].size()))/100.0);
+                        std::vector<std::string> token = Utils::Utils::tokenize(hypergraph.get_pin_name(i), "_");
+                        factor_width = (std::stoi(token[0].substr(1, token[0].size()))/100.0);
+                        factor_height = (std::stoi(token[1].substr(1, token[1].size()))/100.0);
                     }
 
-                    //feed << "# " << m->get_id() << std::endl;
                     if (this->check_name_dac2002(m->get_id())){
                         feed << m->get_id() << " B : " << width * factor_width << " " << height * factor_height << std::endl;
                     } else {
@@ -1050,14 +967,11 @@ void Bookshelf::deduce_layout()
     size_t y = 0;
 
     for (Terminal* terminal: m_terminals){
-        assertion_check (terminal->get_pos_x().is_numeral());
-        assertion_check (terminal->get_pos_y().is_numeral());
-
-        if (terminal->get_pos_x().get_numeral_uint() > x){
-            x = terminal->get_pos_x().get_numeral_uint();
+        if (terminal->get_pox_x_numerical() > x){
+            x = terminal->get_pox_x_numerical();
         }
-        if (terminal->get_pos_y().get_numeral_uint() > y){
-            y = terminal->get_pos_y().get_numeral_uint();
+        if (terminal->get_pos_y_numerical() > y){
+            y = terminal->get_pos_y_numerical();
         }
     }
 
@@ -16,9 +16,11 @@
 #include <macro_definition.hpp>
 #include <terminal_definition.hpp>
 #include <utils.hpp>
+#include <mapped_file.hpp>
 #include <macro.hpp>
 #include <terminal.hpp>
 #include <tree.hpp>
+#include <symbol_table.hpp>
 #include <logger.hpp>
 #include <exception.hpp>
 
@@ -26,8 +28,10 @@
 #include <z3++.h>
 #include <fstream>
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <exception>
 #include <algorithm>
 
@@ -65,6 +69,8 @@ public:
     Tree* get_tree();
     void set_tree(Tree * tree);
 
+    SymbolTable* get_symbol_table();
+
 private:
     void read_aux();
     void read_blocks();
@@ -88,6 +94,7 @@ private:
     std::vector<Terminal*> m_terminals;
     std::vector<TerminalDefinition> m_terminal_definitions;
     Tree* m_tree;
+    SymbolTable* m_symbols;
     Utils::Logger* m_logger;
 
     size_t m_expected_macros;
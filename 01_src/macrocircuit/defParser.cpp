@@ -129,6 +129,9 @@ static unordered_map<int, int>* defRowY2OrientMapPtr = 0;
 static vector<unordered_map<string, int>>* defComponentPinToNetPtr = 0;
 static unordered_map<string, int>* currentPinMap = 0;
 
+// compact mode, records replace the defi objects above
+static Circuit::DefDatabase* defDatabasePtr = 0;
+
 
 // TX_DIR:TRANSLATION ON
 
@@ -202,6 +205,21 @@ int compMSL(defrCallbackType_e c, defiComponentMaskShiftLayer* co, defiUserData
 
 
 int compf(defrCallbackType_e c, defiComponent* co, defiUserData ud) {
+  if (defDatabasePtr) {
+    checkType(c);
+    if (ud != userData) dataError();
+
+    Circuit::DefDatabase::Component comp;
+    comp.id = defDatabasePtr->Intern(co->id());
+    comp.name = defDatabasePtr->Intern(co->name());
+    comp.x = co->placementX();
+    comp.y = co->placementY();
+    comp.orient = co->placementOrient();
+    comp.status = co->placementStatus();
+    defDatabasePtr->components.push_back(comp);
+    return 0;
+  }
+
   currentPinMap = new unordered_map<string, int>;
 
   (*defComponentMapPtr)[string(co->id())] = defComponentStorPtr->size();
@@ -378,6 +396,21 @@ int netf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
   if (c != defrNetCbkType)
     CIRCUIT_FPRINTF(fout, "BOGUS NET TYPE  ");
 
+  if (defDatabasePtr) {
+    Circuit::DefDatabase::Net cNet;
+    cNet.name = defDatabasePtr->Intern(net->name());
+    cNet.firstConnection = defDatabasePtr->connections.size();
+    cNet.numConnections = net->numConnections();
+    for (i = 0; i < net->numConnections(); i++) {
+      Circuit::DefDatabase::Connection conn;
+      conn.instance = defDatabasePtr->Intern(net->instance(i));
+      conn.pin = defDatabasePtr->Intern(net->pin(i));
+      defDatabasePtr->connections.push_back(conn);
+    }
+    defDatabasePtr->nets.push_back(cNet);
+    return 0;
+  }
+
 
   if (net->pinIsMustJoin(0))
     CIRCUIT_FPRINTF(fout, "- MUSTJOIN ");
@@ -1220,6 +1253,11 @@ int snetf(defrCallbackType_e c, defiNet* net, defiUserData ud) {
   if (c != defrSNetCbkType)
     CIRCUIT_FPRINTF(fout, "BOGUS NET TYPE  ");
 
+  // compact mode drops special nets with the power supply
+  if (defDatabasePtr) {
+    return 0;
+  }
+
   // 5/6/2004 - don't need since I have a callback for the name
   //  CIRCUIT_FPRINTF(fout, "- %s ", net->name());
 
@@ -1663,9 +1701,18 @@ int cs(defrCallbackType_e c, int num, defiUserData ud) {
   if (ud != userData) dataError();
 
   switch (c) {
-    case defrComponentStartCbkType : name = address("COMPONENTS"); defComponentStorPtr->reserve(num); defComponentPinToNetPtr->reserve(num); break;
-    case defrNetStartCbkType : name = address("NETS"); defNetStorPtr->reserve(num); break;
-    case defrStartPinsCbkType : name = address("PINS"); defPinStorPtr->reserve(num); break;
+    case defrComponentStartCbkType : name = address("COMPONENTS"); 
+      if (defDatabasePtr) defDatabasePtr->components.reserve(num);
+      else { defComponentStorPtr->reserve(num); defComponentPinToNetPtr->reserve(num); }
+      break;
+    case defrNetStartCbkType : name = address("NETS"); 
+      if (defDatabasePtr) defDatabasePtr->nets.reserve(num);
+      else defNetStorPtr->reserve(num);
+      break;
+    case defrStartPinsCbkType : name = address("PINS"); 
+      if (defDatabasePtr) defDatabasePtr->pins.reserve(num);
+      else defPinStorPtr->reserve(num);
+      break;
     case defrViaStartCbkType : name = address("VIAS"); break;
     case defrRegionStartCbkType : name = address("REGIONS"); break;
     case defrSNetStartCbkType : name = address("SPECIALNETS"); break;
@@ -2021,6 +2068,13 @@ static int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
       break;
     case defrDieAreaCbkType :
       box = (defiBox*)cl;
+      if (defDatabasePtr) {
+        defDatabasePtr->dieLx = box->xl();
+        defDatabasePtr->dieLy = box->yl();
+        defDatabasePtr->dieUx = box->xh();
+        defDatabasePtr->dieUy = box->yh();
+        break;
+      }
       *defDieAreaPtr = *box;
       CIRCUIT_FPRINTF(fout, "DIEAREA %d %d %d %d ;\n",
           box->xl(), box->yl(), box->xh(),
@@ -2046,6 +2100,24 @@ static int cls(defrCallbackType_e c, void* cl, defiUserData ud) {
     case defrPinCbkType :
       pin = (defiPin*)cl;
 
+      if (defDatabasePtr) {
+        Circuit::DefDatabase::Pin cPin;
+        cPin.name = defDatabasePtr->Intern(pin->pinName());
+        cPin.direction = pin->hasDirection()? 
+          defDatabasePtr->Intern(pin->direction()) : 0;
+        cPin.numPorts = pin->numPorts();
+        cPin.isPlaced = 0;
+        cPin.x = cPin.y = cPin.orient = 0;
+        if (pin->numPorts() > 0 && pin->pinPort(0)->isPlaced()) {
+          cPin.isPlaced = 1;
+          cPin.x = pin->pinPort(0)->placementX();
+          cPin.y = pin->pinPort(0)->placementY();
+          cPin.orient = pin->pinPort(0)->orient();
+        }
+        defDatabasePtr->pins.push_back(cPin);
+        break;
+      }
+
       // update pin data
       (*defPinMapPtr)[ string(pin->pinName()) ] = defPinStorPtr->size();
       defPinStorPtr->push_back(*pin);
@@ -4465,6 +4537,14 @@ void Circuit::Circuit::ParseDef(string fileName) {
 
   defComponentPinToNetPtr = &(this->defComponentPinToNet);
 
+  // compact mode keeps scalars in the database, 
+  // routing is not needed there
+  defDatabasePtr = this->defDatabase;
+  if (defDatabasePtr) {
+    defDesignNamePtr = &(defDatabasePtr->designName);
+    defUnitPtr = &(defDatabasePtr->unit);
+  }
+
   defrInitSession(0);
 
   defrSetWarningLogFunction(printWarning);
@@ -4492,7 +4572,8 @@ void Circuit::Circuit::ParseDef(string fileName) {
     defrSetSNetWireCbk(snetwire);
   defrSetComponentMaskShiftLayerCbk(compMSL);
   defrSetComponentCbk(compf);
-  defrSetAddPathToNet();
+  if (!defDatabasePtr)
+    defrSetAddPathToNet();
   defrSetHistoryCbk(hist);
   defrSetConstraintCbk(constraint);
   defrSetAssertionCbk(constraint);
@@ -4784,6 +4865,8 @@ void Circuit::Circuit::ParseDef(string fileName) {
   // Release allocated singleton data.
   defrClear();
 
+  defDatabasePtr = 0;
+
   free(inFile[0]);
 }
 
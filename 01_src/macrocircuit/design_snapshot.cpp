@@ -0,0 +1,389 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : design_snapshot.cpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : Binary Snapshot of a parsed LEF/DEF Design
+//==================================================================
+#include "design_snapshot.hpp"
+
+using namespace Placer;
+using namespace Placer::Utils;
+
+/**
+ * @brief Constructor
+ */
+DesignSnapshot::DesignSnapshot():
+    Object(),
+    def_units(0),
+    lef_units(0),
+    die_lx(0),
+    die_ly(0),
+    die_ux(0),
+    die_uy(0)
+{
+    m_logger = Logger::getInstance();
+}
+
+/**
+ * @brief Destructor
+ */
+DesignSnapshot::~DesignSnapshot()
+{
+    m_logger = nullptr;
+}
+
+/**
+ * @brief Check if a Snapshot Directory has been configured
+ *
+ * @return bool
+ */
+bool DesignSnapshot::is_enabled() const
+{
+    return !this->get_snapshot_cache().empty();
+}
+
+/**
+ * @brief Add Size and Content Hash of an Input File to the Key
+ *
+ * @param key Key to extend
+ * @param filename Input File
+ */
+void DesignSnapshot::hash_file(std::stringstream & key, std::string const & filename)
+{
+    MappedFile file(filename);
+    std::string_view content = file.get_content();
+
+    key << ";" << content.size() << ":" << Utils::Utils::digest(content);
+}
+
+/**
+ * @brief Build the Key of the current Input Files
+ *
+ * The site decides which LEF macros are Standard-Cells, so it is part of
+ * the key next to the LEF, DEF and supplement contents.
+ *
+ * @return std::string
+ */
+std::string DesignSnapshot::get_key()
+{
+    std::stringstream key;
+    key << s_magic << ":" << s_version << ";" << this->get_site();
+
+    for (std::string const & lef: this->get_lef()){
+        this->hash_file(key, lef);
+    }
+    this->hash_file(key, this->get_def());
+
+    if (!this->get_supplement().empty() && boost::filesystem::exists(this->get_supplement())){
+        this->hash_file(key, this->get_supplement());
+    }
+
+    return key.str();
+}
+
+/**
+ * @brief Get the File of a Snapshot
+ *
+ * The snapshot stores the full key, colliding keys are told apart on load.
+ *
+ * @param key Key of the Input Files
+ * @return std::string
+ */
+std::string DesignSnapshot::get_filename(std::string const & key)
+{
+    return this->get_snapshot_cache() + "/" + Utils::Utils::digest(key) + ".snap";
+}
+
+/**
+ * @brief Load the Snapshot of the current Input Files
+ *
+ * @return bool True if a matching Snapshot exists
+ */
+bool DesignSnapshot::load()
+{
+    m_key = this->get_key();
+    std::string filename = this->get_filename(m_key);
+
+    if (!boost::filesystem::exists(filename)){
+        return false;
+    }
+
+    try {
+        MappedFile file(filename);
+        Reader in{file.get_content(), 0};
+
+        if (in.data.size() < sizeof(s_magic) - 1 ||
+            in.data.substr(0, sizeof(s_magic) - 1) != std::string_view(s_magic, sizeof(s_magic) - 1)){
+            return false;
+        }
+        in.pos = sizeof(s_magic) - 1;
+
+        // Older Layouts, Hash Collisions and damaged Files are rebuilt
+        // from the parser
+        if (in.read_u64() != s_version || in.read_string() != m_key){
+            return false;
+        }
+        this->read(in);
+    } catch (std::runtime_error const &){
+        macros.clear();
+        cells.clear();
+        terminals.clear();
+        nets.clear();
+        return false;
+    }
+    m_logger->load_snapshot(filename);
+
+    return true;
+}
+
+/**
+ * @brief Store the Snapshot of the current Input Files
+ *
+ * The snapshot is written to a temporary file and renamed, concurrent
+ * runs sharing the directory never read a partial snapshot.
+ */
+void DesignSnapshot::store()
+{
+    try {
+        if (m_key.empty()){
+            m_key = this->get_key();
+        }
+        if (!boost::filesystem::exists(this->get_snapshot_cache())){
+            boost::filesystem::create_directories(this->get_snapshot_cache());
+        }
+
+        std::string filename = this->get_filename(m_key);
+        boost::filesystem::path tmp = boost::filesystem::unique_path(filename + ".%%%%%%");
+
+        std::ofstream out(tmp.string(), std::ios::binary);
+        if (!out.is_open()){
+            throw PlacerException("Can not open file (" + tmp.string() + ")");
+        }
+        out.write(s_magic, sizeof(s_magic) - 1);
+        write_u64(out, s_version);
+        write_string(out, m_key);
+        this->write(out);
+        out.close();
+
+        boost::filesystem::rename(tmp, filename);
+        m_logger->store_snapshot(filename);
+    } catch (boost::filesystem::filesystem_error const & exp){
+        throw PlacerException(exp.what());
+    }
+}
+
+/**
+ * @brief Read the Design following the Header
+ *
+ * @param in Cursor behind the Key
+ */
+void DesignSnapshot::read(Reader & in)
+{
+    design_name = in.read_string();
+    def_units = in.read_u64();
+    lef_units = in.read_u64();
+    die_lx = in.read_u64();
+    die_ly = in.read_u64();
+    die_ux = in.read_u64();
+    die_uy = in.read_u64();
+
+    macros.resize(in.read_count());
+    for (MacroDefinition & macro: macros){
+        macro.name = in.read_string();
+        macro.id = in.read_string();
+        macro.width = in.read_u64();
+        macro.height = in.read_u64();
+        macro.lx = in.read_u64();
+        macro.ly = in.read_u64();
+        macro.orientation = static_cast<eOrientation>(in.read_u64());
+
+        uint64_t flags = in.read_u64();
+        macro.is_placed = flags & 0x1;
+        macro.is_unplaced = flags & 0x2;
+        macro.is_fixed = flags & 0x4;
+        macro.is_cover = flags & 0x8;
+
+        macro.pin_definitions.resize(in.read_count());
+        for (PinDefinition & pin: macro.pin_definitions){
+            pin.parent = macro.id;
+            pin.name = in.read_string();
+            pin.direction = in.read_string();
+        }
+    }
+
+    cells.resize(in.read_count());
+    for (CellRecord & cell: cells){
+        cell.name = in.read_string();
+        cell.id = in.read_string();
+    }
+
+    terminals.resize(in.read_count());
+    for (TerminalRecord & terminal: terminals){
+        terminal.name = in.read_string();
+        terminal.direction = in.read_string();
+        terminal.is_placed = in.read_u64() != 0;
+        terminal.x = in.read_u64();
+        terminal.y = in.read_u64();
+        terminal.orientation = static_cast<eOrientation>(in.read_u64());
+    }
+
+    nets.resize(in.read_count());
+    for (NetRecord & net: nets){
+        net.name = in.read_string();
+        net.instances.resize(in.read_count());
+        net.pins.resize(net.instances.size());
+        for (size_t i = 0; i < net.instances.size(); ++i){
+            net.instances[i] = in.read_string();
+            net.pins[i] = in.read_string();
+        }
+    }
+
+    if (in.pos != in.data.size()){
+        throw std::runtime_error("Trailing Data in Design Snapshot");
+    }
+}
+
+/**
+ * @brief Write the Design following the Header
+ *
+ * @param out Binary Output Stream
+ */
+void DesignSnapshot::write(std::ofstream & out)
+{
+    write_string(out, design_name);
+    write_u64(out, def_units);
+    write_u64(out, lef_units);
+    write_u64(out, die_lx);
+    write_u64(out, die_ly);
+    write_u64(out, die_ux);
+    write_u64(out, die_uy);
+
+    write_u64(out, macros.size());
+    for (MacroDefinition const & macro: macros){
+        write_string(out, macro.name);
+        write_string(out, macro.id);
+        write_u64(out, macro.width);
+        write_u64(out, macro.height);
+        write_u64(out, macro.lx);
+        write_u64(out, macro.ly);
+        write_u64(out, macro.orientation);
+        write_u64(out, (macro.is_placed   ? 0x1 : 0) |
+                       (macro.is_unplaced ? 0x2 : 0) |
+                       (macro.is_fixed    ? 0x4 : 0) |
+                       (macro.is_cover    ? 0x8 : 0));
+
+        write_u64(out, macro.pin_definitions.size());
+        for (PinDefinition const & pin: macro.pin_definitions){
+            write_string(out, pin.name);
+            write_string(out, pin.direction);
+        }
+    }
+
+    write_u64(out, cells.size());
+    for (CellRecord const & cell: cells){
+        write_string(out, cell.name);
+        write_string(out, cell.id);
+    }
+
+    write_u64(out, terminals.size());
+    for (TerminalRecord const & terminal: terminals){
+        write_string(out, terminal.name);
+        write_string(out, terminal.direction);
+        write_u64(out, terminal.is_placed);
+        write_u64(out, terminal.x);
+        write_u64(out, terminal.y);
+        write_u64(out, terminal.orientation);
+    }
+
+    write_u64(out, nets.size());
+    for (NetRecord const & net: nets){
+        write_string(out, net.name);
+        write_u64(out, net.instances.size());
+        for (size_t i = 0; i < net.instances.size(); ++i){
+            write_string(out, net.instances[i]);
+            write_string(out, net.pins[i]);
+        }
+    }
+}
+
+/**
+ * @brief Append a Value to the Stream
+ *
+ * @param out Binary Output Stream
+ * @param val Value
+ */
+void DesignSnapshot::write_u64(std::ofstream & out, uint64_t const val)
+{
+    out.write(reinterpret_cast<char const *>(&val), sizeof(val));
+}
+
+/**
+ * @brief Append a length prefixed String to the Stream
+ *
+ * @param out Binary Output Stream
+ * @param val String
+ */
+void DesignSnapshot::write_string(std::ofstream & out, std::string const & val)
+{
+    write_u64(out, val.size());
+    out.write(val.data(), val.size());
+}
+
+/**
+ * @brief Read the next Value
+ *
+ * @return uint64_t
+ */
+uint64_t DesignSnapshot::Reader::read_u64()
+{
+    if (data.size() - pos < sizeof(uint64_t)){
+        throw std::runtime_error("Truncated Design Snapshot");
+    }
+
+    uint64_t val = 0;
+    std::memcpy(&val, data.data() + pos, sizeof(val));
+    pos += sizeof(val);
+
+    return val;
+}
+
+/**
+ * @brief Read the Number of following Records
+ *
+ * Every record takes at least one value, a corrupted count fails here
+ * instead of allocating.
+ *
+ * @return size_t
+ */
+size_t DesignSnapshot::Reader::read_count()
+{
+    uint64_t count = this->read_u64();
+    if (count > (data.size() - pos) / sizeof(uint64_t)){
+        throw std::runtime_error("Corrupted Design Snapshot");
+    }
+
+    return count;
+}
+
+/**
+ * @brief Read the next length prefixed String
+ *
+ * @return std::string
+ */
+std::string DesignSnapshot::Reader::read_string()
+{
+    uint64_t size = this->read_u64();
+    if (data.size() - pos < size){
+        throw std::runtime_error("Truncated Design Snapshot");
+    }
+
+    std::string val(data.data() + pos, size);
+    pos += size;
+
+    return val;
+}
@@ -0,0 +1,129 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : design_snapshot.hpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : Binary Snapshot of a parsed LEF/DEF Design
+//==================================================================
+#ifndef DESIGN_SNAPSHOT_HPP
+#define DESIGN_SNAPSHOT_HPP
+
+#include <object.hpp>
+#include <macro_definition.hpp>
+#include <mapped_file.hpp>
+#include <logger.hpp>
+#include <exception.hpp>
+#include <utils.hpp>
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <fstream>
+#include <sstream>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#include <boost/filesystem.hpp>
+
+namespace Placer {
+
+/**
+ * @class DesignSnapshot
+ * @brief Everything the placer takes from the LEF/DEF parser output. It is
+ *        filled either from the parser or from a versioned binary file in
+ *        the snapshot cache, keyed by the content of all input files. A
+ *        hit skips the parser, Components and the Tree are rebuilt from it.
+ */
+class DesignSnapshot: public virtual Object {
+public:
+    /**
+     * @brief Standard-Cell Instance
+     */
+    struct CellRecord {
+        std::string name;
+        std::string id;
+    };
+
+    /**
+     * @brief Terminal, Position in Microns
+     */
+    struct TerminalRecord {
+        std::string name;
+        std::string direction;
+        bool is_placed;
+        size_t x;
+        size_t y;
+        eOrientation orientation;
+    };
+
+    /**
+     * @brief Net with at least two Connections
+     */
+    struct NetRecord {
+        std::string name;
+        std::vector<std::string> instances;
+        std::vector<std::string> pins;
+    };
+
+    DesignSnapshot();
+
+    virtual ~DesignSnapshot();
+
+    bool is_enabled() const;
+
+    bool load();
+    void store();
+
+    std::string design_name;
+    size_t def_units;
+    size_t lef_units;
+
+    size_t die_lx;
+    size_t die_ly;
+    size_t die_ux;
+    size_t die_uy;
+
+    std::vector<MacroDefinition> macros;
+    std::vector<CellRecord> cells;
+    std::vector<TerminalRecord> terminals;
+    std::vector<NetRecord> nets;
+
+private:
+    static constexpr char s_magic[] = "SMTPSNP1";
+    static constexpr uint64_t s_version = 1;
+
+    /**
+     * @brief Bounds checked Cursor over the mapped Snapshot
+     */
+    struct Reader {
+        std::string_view data;
+        size_t pos;
+
+        uint64_t read_u64();
+        size_t read_count();
+        std::string read_string();
+    };
+
+    Utils::Logger* m_logger;
+    std::string m_key;
+
+    std::string get_key();
+    std::string get_filename(std::string const & key);
+
+    void hash_file(std::stringstream & key, std::string const & filename);
+
+    void read(Reader & in);
+    void write(std::ofstream & out);
+
+    static void write_u64(std::ofstream & out, uint64_t const val);
+    static void write_string(std::ofstream & out, std::string const & val);
+};
+
+} /* namespace Placer */
+
+#endif /* DESIGN_SNAPSHOT_HPP */
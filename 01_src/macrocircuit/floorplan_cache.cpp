@@ -0,0 +1,258 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : floorplan_cache.cpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : Persistent Cache of solved Partitions
+//==================================================================
+#include "floorplan_cache.hpp"
+
+using namespace Placer;
+using namespace Placer::Utils;
+
+/**
+ * @brief Constructor
+ */
+FloorplanCache::FloorplanCache():
+    Object()
+{
+    m_logger = Logger::getInstance();
+    m_hits = 0;
+    m_misses = 0;
+}
+
+/**
+ * @brief Destructor
+ */
+FloorplanCache::~FloorplanCache()
+{
+    m_logger = nullptr;
+}
+
+/**
+ * @brief Check if a Cache Directory has been configured
+ *
+ * @return bool
+ */
+bool FloorplanCache::is_enabled() const
+{
+    return !this->get_floorplan_cache().empty();
+}
+
+/**
+ * @brief Sort Components by their Dimensions
+ *
+ * Components with equal dimensions are interchangeable, the sorted order
+ * maps cached positions onto any partition with the same multiset.
+ *
+ * @param next_partition Partition
+ * @return std::vector< Placer::Component* >
+ */
+std::vector<Component*> FloorplanCache::canonical_order(Partition* next_partition)
+{
+    std::vector<Component*> components = next_partition->get_components();
+
+    std::stable_sort(components.begin(), components.end(), [](Component* a, Component* b){
+        std::pair<size_t, size_t> dim_a(a->get_width_numeral(), a->get_height_numeral());
+        std::pair<size_t, size_t> dim_b(b->get_width_numeral(), b->get_height_numeral());
+        return dim_a < dim_b;
+    });
+
+    return components;
+}
+
+/**
+ * @brief Build the Key of a Dimension Multiset
+ *
+ * @param components Components in canonical order
+ * @param encoding Rotation Freedom and Objective of the Encoding
+ * @return std::string
+ */
+std::string FloorplanCache::canonical_key(std::vector<Component*> const & components,
+                                          std::string const & encoding)
+{
+    std::stringstream key;
+    key << encoding;
+    for (Component* c: components){
+        key << ";" << c->get_width_numeral() << "x" << c->get_height_numeral();
+    }
+
+    return key.str();
+}
+
+/**
+ * @brief Get the File of a Cache Entry
+ *
+ * The file stores the full key, colliding keys are told apart on load.
+ *
+ * @param key Canonical Key
+ * @return std::string
+ */
+std::string FloorplanCache::get_filename(std::string const & key)
+{
+    return this->get_floorplan_cache() + "/" + Utils::Utils::digest(key) + ".fp";
+}
+
+/**
+ * @brief Apply a cached Solution to the Partition
+ *
+ * @param next_partition Partition to Place
+ * @param encoding Rotation Freedom and Objective of the Encoding
+ * @return bool True if the Partition was found in the Cache
+ */
+bool FloorplanCache::lookup(Partition* next_partition, std::string const & encoding)
+{
+    nullpointer_check (next_partition);
+
+    std::vector<Component*> components = this->canonical_order(next_partition);
+    std::string key = this->canonical_key(components, encoding);
+
+    auto find = m_entries.find(key);
+    if (find == m_entries.end()){
+        Entry entry;
+        if (!this->read_entry(key, entry)){
+            m_misses++;
+            return false;
+        }
+        find = m_entries.insert(std::make_pair(key, entry)).first;
+    }
+
+    Entry const & entry = find->second;
+    assertion_check (entry.lx.size() == components.size());
+
+    next_partition->set_lx(0);
+    next_partition->set_ly(0);
+    next_partition->set_ux(entry.ux);
+    next_partition->set_uy(entry.uy);
+
+    for (size_t i = 0; i < components.size(); ++i){
+        components[i]->add_solution(entry.lx[i],
+                                    entry.ly[i],
+                                    static_cast<eOrientation>(entry.orientation[i]));
+    }
+    m_hits++;
+
+    return true;
+}
+
+/**
+ * @brief Store the Solution of a Partition
+ *
+ * @param next_partition Solved Partition
+ * @param encoding Rotation Freedom and Objective of the Encoding
+ * @param m Model in the shared context
+ */
+void FloorplanCache::store(Partition* next_partition,
+                           std::string const & encoding,
+                           z3::model const & m)
+{
+    nullpointer_check (next_partition);
+
+    std::vector<Component*> components = this->canonical_order(next_partition);
+    std::string key = this->canonical_key(components, encoding);
+
+    Entry entry;
+    entry.ux = m.eval(next_partition->get_ux()).get_numeral_uint();
+    entry.uy = m.eval(next_partition->get_uy()).get_numeral_uint();
+    for (Component* c: components){
+        entry.lx.push_back(m.eval(c->get_lx()).get_numeral_uint());
+        entry.ly.push_back(m.eval(c->get_ly()).get_numeral_uint());
+        entry.orientation.push_back(m.eval(c->get_orientation()).get_numeral_uint());
+    }
+
+    m_entries[key] = entry;
+    this->write_entry(key, entry);
+}
+
+/**
+ * @brief Read a Cache Entry from Disk
+ *
+ * @param key Canonical Key
+ * @param entry Entry to fill
+ * @return bool True if a matching Entry exists
+ */
+bool FloorplanCache::read_entry(std::string const & key, Entry & entry)
+{
+    std::ifstream in(this->get_filename(key));
+    if (!in.is_open()){
+        return false;
+    }
+
+    // Guard against Hash Collisions
+    std::string stored_key;
+    std::getline(in, stored_key);
+    if (stored_key != key){
+        return false;
+    }
+
+    size_t count = 0;
+    in >> entry.ux >> entry.uy >> count;
+    for (size_t i = 0; i < count; ++i){
+        size_t lx = 0;
+        size_t ly = 0;
+        size_t orientation = 0;
+        in >> lx >> ly >> orientation;
+        entry.lx.push_back(lx);
+        entry.ly.push_back(ly);
+        entry.orientation.push_back(orientation);
+    }
+
+    return !in.fail();
+}
+
+/**
+ * @brief Write a Cache Entry to Disk
+ *
+ * The entry is written to a temporary file and renamed, concurrent runs
+ * sharing the directory never read a partial entry.
+ *
+ * @param key Canonical Key
+ * @param entry Entry to write
+ */
+void FloorplanCache::write_entry(std::string const & key, Entry const & entry)
+{
+    try {
+        if (!boost::filesystem::exists(this->get_floorplan_cache())){
+            boost::filesystem::create_directories(this->get_floorplan_cache());
+        }
+
+        std::string filename = this->get_filename(key);
+        boost::filesystem::path tmp = boost::filesystem::unique_path(filename + ".%%%%%%");
+
+        std::ofstream out(tmp.string());
+        out << key << std::endl;
+        out << entry.ux << " " << entry.uy << " " << entry.lx.size() << std::endl;
+        for (size_t i = 0; i < entry.lx.size(); ++i){
+            out << entry.lx[i] << " " << entry.ly[i] << " " << entry.orientation[i] << std::endl;
+        }
+        out.close();
+
+        boost::filesystem::rename(tmp, filename);
+    } catch (boost::filesystem::filesystem_error const & exp){
+        throw PlacerException(exp.what());
+    }
+}
+
+/**
+ * @brief Get Number of Partitions taken from the Cache
+ *
+ * @return size_t
+ */
+size_t FloorplanCache::get_hits() const
+{
+    return m_hits;
+}
+
+/**
+ * @brief Get Number of Partitions not found in the Cache
+ *
+ * @return size_t
+ */
+size_t FloorplanCache::get_misses() const
+{
+    return m_misses;
+}
@@ -0,0 +1,82 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : floorplan_cache.hpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : Persistent Cache of solved Partitions
+//==================================================================
+#ifndef FLOORPLAN_CACHE_HPP
+#define FLOORPLAN_CACHE_HPP
+
+#include <object.hpp>
+#include <partition.hpp>
+#include <component.hpp>
+#include <logger.hpp>
+#include <exception.hpp>
+#include <utils.hpp>
+
+#include <map>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+#include <boost/filesystem.hpp>
+#include <z3++.h>
+
+namespace Placer {
+
+/**
+ * @class FloorplanCache
+ * @brief Stores the packed shape and the relative component positions of
+ *        solved partitions on disk. Entries are keyed by the sorted
+ *        multiset of component dimensions and the encoding, partitions
+ *        with equal shapes are never solved twice.
+ */
+class FloorplanCache: public virtual Object {
+public:
+    FloorplanCache();
+
+    virtual ~FloorplanCache();
+
+    bool is_enabled() const;
+
+    bool lookup(Partition* next_partition, std::string const & encoding);
+    void store(Partition* next_partition,
+               std::string const & encoding,
+               z3::model const & m);
+
+    size_t get_hits() const;
+    size_t get_misses() const;
+
+private:
+    struct Entry {
+        size_t ux;
+        size_t uy;
+        std::vector<size_t> lx;
+        std::vector<size_t> ly;
+        std::vector<size_t> orientation;
+    };
+
+    Utils::Logger* m_logger;
+    std::map<std::string, Entry> m_entries;
+    size_t m_hits;
+    size_t m_misses;
+
+    std::vector<Component*> canonical_order(Partition* next_partition);
+    std::string canonical_key(std::vector<Component*> const & components,
+                              std::string const & encoding);
+    std::string get_filename(std::string const & key);
+
+    bool read_entry(std::string const & key, Entry & entry);
+    void write_entry(std::string const & key, Entry const & entry);
+};
+
+} /* namespace Placer */
+
+#endif /* FLOORPLAN_CACHE_HPP */
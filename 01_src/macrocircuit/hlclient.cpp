@@ -108,9 +108,7 @@ void HLClient::deserialize()
         Macro* macro = this->find_macro(id);
         nullpointer_check(macro);
         m_logger->place_macro(id, m.lx(), m.ly(), eNorth);
-        macro->add_solution_lx(m.lx());
-        macro->add_solution_ly(m.ly());
-        macro->add_solution_orientation(static_cast<eOrientation>(m.orientation()));
+        macro->add_solution(m.lx(), m.ly(), static_cast<eOrientation>(m.orientation()));
     }
 
     PlacerProto::Layout l = m_proto->l();
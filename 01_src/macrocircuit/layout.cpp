@@ -26,6 +26,10 @@ Layout::Layout ():
     m_free_ly(true),
     m_free_ux(true),
     m_free_uy(true),
+    m_value_lx(0),
+    m_value_ly(0),
+    m_value_ux(0),
+    m_value_uy(0),
     m_lx(m_encode->get_constant("die_lx")),
     m_ly(m_encode->get_constant("die_ly")),
     m_ux(m_encode->get_constant("die_ux")),
@@ -148,6 +152,7 @@ void Layout::set_lx(size_t const val)
 {
     m_logger->set_die_lx(val);
     m_free_lx = false;
+    m_value_lx = val;
     m_lx = m_encode->get_value(val);
 }
 
@@ -160,6 +165,7 @@ void Layout::set_ly(size_t const val)
 {
     m_logger->set_die_ly(val);
     m_free_ly = false;
+    m_value_ly = val;
     m_ly = m_encode->get_value(val);
 }
 
@@ -172,6 +178,7 @@ void Layout::set_ux(size_t const val)
 {
     m_logger->set_die_ux(val);
     m_free_ux = false;
+    m_value_ux = val;
     m_ux = m_encode->get_value(val);
 }
 
@@ -184,6 +191,7 @@ void Layout::set_uy(size_t const val)
 {
     m_logger->set_die_uy(val);
     m_free_uy = false;
+    m_value_uy = val;
     m_uy = m_encode->get_value(val);
 }
 
@@ -339,9 +347,9 @@ void Layout::set_formula_uy (z3::expr const & formula)
  */
 size_t Layout::get_ly_numerical()
 {
-    assertion_check (m_ly.is_numeral());
+    assertion_check (!m_free_ly);
 
-    return m_ly.get_numeral_uint();
+    return m_value_ly;
 }
 
 /**
@@ -351,9 +359,9 @@ size_t Layout::get_ly_numerical()
  */
 size_t Layout::get_lx_numerical()
 {
-    assertion_check (m_lx.is_numeral());
+    assertion_check (!m_free_lx);
 
-    return m_lx.get_numeral_uint();
+    return m_value_lx;
 }
 
 /**
@@ -363,9 +371,9 @@ size_t Layout::get_lx_numerical()
  */
 size_t Layout::get_ux_numercial()
 {
-    assertion_check (m_ux.is_numeral());
+    assertion_check (!m_free_ux);
 
-    return m_ux.get_numeral_uint();
+    return m_value_ux;
 }
 
 /**
@@ -375,7 +383,7 @@ size_t Layout::get_ux_numercial()
  */
 size_t Layout::get_uy_numerical()
 {
-    assertion_check (m_uy.is_numeral());
+    assertion_check (!m_free_uy);
 
-    return m_uy.get_numeral_uint();
+    return m_value_uy;
 }
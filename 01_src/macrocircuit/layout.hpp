@@ -88,6 +88,11 @@ private:
     bool m_free_ux;
     bool m_free_uy;
 
+    size_t m_value_lx;
+    size_t m_value_ly;
+    size_t m_value_ux;
+    size_t m_value_uy;
+
     std::vector<size_t> m_solutions_ux;
     std::vector<size_t> m_solutions_uy;
 
@@ -0,0 +1,606 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : lef_library.cpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : Compact LEF Library shared between Runs
+//==================================================================
+#include "lef_library.hpp"
+
+using namespace Placer;
+using namespace Placer::Utils;
+
+std::map<std::string, LefLibrary*> LefLibrary::s_shared;
+
+/**
+ * @brief Constructor
+ *
+ * @param filename LEF File the Library is cached for
+ */
+LefLibrary::LefLibrary(std::string const & filename):
+    Object(),
+    m_filename(filename),
+    m_shared(false),
+    m_file(nullptr),
+    m_header(nullptr),
+    m_sites(nullptr),
+    m_macros(nullptr),
+    m_pins(nullptr),
+    m_strings(nullptr)
+{
+    m_logger = Logger::getInstance();
+}
+
+/**
+ * @brief Destructor
+ */
+LefLibrary::~LefLibrary()
+{
+    delete m_file; m_file = nullptr;
+    m_logger = nullptr;
+}
+
+/**
+ * @brief Check if a Library Directory has been configured
+ *
+ * @return bool
+ */
+bool LefLibrary::is_enabled() const
+{
+    return !this->get_lef_cache().empty();
+}
+
+/**
+ * @brief Register a Library for all Runs of this Process
+ *
+ * Only called before runs start, the registry takes ownership and keeps
+ * the library until the process ends.
+ *
+ * @param library Library of a LEF File
+ */
+void LefLibrary::share(LefLibrary* library)
+{
+    nullpointer_check (library);
+    assertion_check (!library->m_filename.empty());
+
+    library->m_shared = true;
+    s_shared[get_shared_key(library->m_filename)] = library;
+}
+
+/**
+ * @brief Find the shared Library of a LEF File
+ *
+ * @param filename Absolute Path of the LEF File
+ * @return LefLibrary* nullptr if none was shared
+ */
+LefLibrary* LefLibrary::find_shared(std::string const & filename)
+{
+    if (s_shared.empty()){
+        return nullptr;
+    }
+
+    auto itor = s_shared.find(get_shared_key(filename));
+    if (itor == s_shared.end()){
+        return nullptr;
+    }
+
+    return itor->second;
+}
+
+/**
+ * @brief Registry Key of a LEF File
+ *
+ * Jobs resolve their files against the working directory, which may be
+ * reached through other links than the directory of the batch manifest.
+ *
+ * @param filename Path of the LEF File
+ * @return std::string
+ */
+std::string LefLibrary::get_shared_key(std::string const & filename)
+{
+    return boost::filesystem::weakly_canonical(filename).string();
+}
+
+/**
+ * @brief Check if the Library is owned by the shared Registry
+ *
+ * @return bool
+ */
+bool LefLibrary::is_shared() const
+{
+    return m_shared;
+}
+
+/**
+ * @brief Build the Key of the LEF File from its Size and Content
+ *
+ * @return std::string
+ */
+std::string LefLibrary::get_key()
+{
+    MappedFile file(m_filename);
+    std::string_view content = file.get_content();
+
+    std::stringstream key;
+    key << s_magic << ":" << s_version << ";"
+        << content.size() << ":" << Utils::Utils::digest(content);
+
+    return key.str();
+}
+
+/**
+ * @brief Get the File of a cached Library
+ *
+ * The library stores the full key, colliding keys are told apart on attach.
+ *
+ * @param key Key of the LEF File
+ * @return std::string
+ */
+std::string LefLibrary::get_cache_filename(std::string const & key)
+{
+    return this->get_lef_cache() + "/" + Utils::Utils::digest(key) + ".lib";
+}
+
+/**
+ * @brief Round a Size up to whole Words
+ *
+ * @param size Size in Bytes
+ * @return size_t
+ */
+size_t LefLibrary::padded(size_t const size)
+{
+    return (size + 7) & ~size_t(7);
+}
+
+/**
+ * @brief Sizes of the Header, the Records and a double in one Word
+ *
+ * @return uint64_t
+ */
+uint64_t LefLibrary::get_layout()
+{
+    return (uint64_t(sizeof(Header)) << 40) |
+           (uint64_t(sizeof(SiteRecord)) << 30) |
+           (uint64_t(sizeof(MacroRecord)) << 20) |
+           (uint64_t(sizeof(PinRecord)) << 10) |
+           uint64_t(sizeof(double));
+}
+
+/**
+ * @brief Map the cached Library of the LEF File
+ *
+ * @return bool True if a matching Library exists
+ */
+bool LefLibrary::load()
+{
+    m_key = this->get_key();
+    std::string filename = this->get_cache_filename(m_key);
+
+    if (!boost::filesystem::exists(filename)){
+        return false;
+    }
+
+    MappedFile* file = new MappedFile(filename);
+    if (!this->attach(file->get_content())){
+        delete file;
+        return false;
+    }
+    delete m_file;
+    m_file = file;
+    m_buffer.clear();
+
+    m_logger->load_lef_library(m_filename, filename);
+
+    return true;
+}
+
+/**
+ * @brief Map the cached Library or parse the LEF File alone
+ *
+ * A parsed library is written to the cache if one is configured.
+ */
+void LefLibrary::read()
+{
+    if (this->is_enabled() && this->load()){
+        return;
+    }
+
+    std::vector<std::string> files(1, m_filename);
+    Circuit::Circuit circuit;
+    circuit.InitLef(files);
+    this->digest(circuit);
+    if (this->is_enabled()){
+        this->store();
+    }
+}
+
+/**
+ * @brief Write the Library to the Cache
+ *
+ * The library is written to a temporary file and renamed, concurrent
+ * runs sharing the directory never map a partial library.
+ */
+void LefLibrary::store()
+{
+    assertion_check (!m_buffer.empty());
+
+    try {
+        if (m_key.empty()){
+            m_key = this->get_key();
+        }
+        if (!boost::filesystem::exists(this->get_lef_cache())){
+            boost::filesystem::create_directories(this->get_lef_cache());
+        }
+
+        std::string filename = this->get_cache_filename(m_key);
+        boost::filesystem::path tmp = boost::filesystem::unique_path(filename + ".%%%%%%");
+
+        std::ofstream out(tmp.string(), std::ios::binary);
+        if (!out.is_open()){
+            throw PlacerException("Can not open file (" + tmp.string() + ")");
+        }
+        out.write(reinterpret_cast<char const *>(m_buffer.data()), m_buffer.size() * sizeof(uint64_t));
+        out.close();
+
+        boost::filesystem::rename(tmp, filename);
+        m_logger->store_lef_library(m_filename, filename);
+    } catch (boost::filesystem::filesystem_error const & exp){
+        throw PlacerException(exp.what());
+    }
+}
+
+/**
+ * @brief Build the Library from the LEF Part of the Parser Output
+ *
+ * Later macro definitions replace earlier ones, as in the parser.
+ *
+ * @param circuit Parser Output
+ */
+void LefLibrary::digest(Circuit::Circuit & circuit)
+{
+    using namespace LefDefParser;
+
+    if (m_key.empty() && this->is_enabled() && !m_filename.empty()){
+        m_key = this->get_key();
+    }
+
+    // Offset zero is the empty String
+    std::string strings(1, '\0');
+    auto add_string = [&strings](char const * val){
+        if (val == nullptr || *val == '\0'){
+            return uint64_t(0);
+        }
+        uint64_t offset = strings.size();
+        strings += val;
+        strings += '\0';
+        return offset;
+    };
+
+    std::vector<SiteRecord> sites;
+    for (lefiSite & itor: circuit.lefSiteStor){
+        SiteRecord site;
+        site.site_class = add_string(itor.hasClass() ? itor.siteClass() : nullptr);
+        site.size_x = itor.sizeX();
+        site.size_y = itor.sizeY();
+        sites.push_back(site);
+    }
+
+    std::vector<std::pair<std::string, int>> names(circuit.lefMacroMap.begin(), circuit.lefMacroMap.end());
+    std::sort(names.begin(), names.end());
+
+    std::vector<MacroRecord> macros;
+    std::vector<PinRecord> pins;
+    for (auto const & itor: names){
+        lefiMacro & lef_data = circuit.lefMacroStor[itor.second];
+
+        MacroRecord macro;
+        macro.name = add_string(itor.first.c_str());
+        macro.size_x = lef_data.sizeX();
+        macro.size_y = lef_data.sizeY();
+        macro.first_pin = pins.size();
+        macro.num_pins = circuit.lefPinStor[itor.second].size();
+        macros.push_back(macro);
+
+        for (lefiPin & lef_pin: circuit.lefPinStor[itor.second]){
+            PinRecord pin;
+            pin.name = add_string(lef_pin.name());
+            pin.direction = add_string(lef_pin.hasDirection() ? lef_pin.direction() : nullptr);
+            pin.shape = PinShape{0, 0, 0, 0};
+
+            bool first = true;
+            for (int i = 0; i < lef_pin.numPorts(); ++i){
+                lefiGeometries* port = lef_pin.port(i);
+                for (int j = 0; j < port->numItems(); ++j){
+                    if (port->itemType(j) != lefiGeomRectE){
+                        continue;
+                    }
+                    lefiGeomRect* rect = port->getRect(j);
+                    if (first){
+                        pin.shape = PinShape{rect->xl, rect->yl, rect->xh, rect->yh};
+                        first = false;
+                    } else {
+                        pin.shape.lx = std::min(pin.shape.lx, rect->xl);
+                        pin.shape.ly = std::min(pin.shape.ly, rect->yl);
+                        pin.shape.ux = std::max(pin.shape.ux, rect->xh);
+                        pin.shape.uy = std::max(pin.shape.uy, rect->yh);
+                    }
+                }
+            }
+            pins.push_back(pin);
+        }
+    }
+
+    Header header;
+    std::memcpy(header.magic, s_magic, sizeof(header.magic));
+    header.version = s_version;
+    header.byte_order = s_byte_order;
+    header.layout = get_layout();
+    header.key_size = m_key.size();
+    header.database_units = circuit.lefUnit.hasDatabase() ?
+                            static_cast<uint64_t>(circuit.lefUnit.databaseNumber()) : 0;
+    header.num_sites = sites.size();
+    header.num_macros = macros.size();
+    header.num_pins = pins.size();
+    header.strings_size = padded(strings.size());
+
+    std::string data;
+    data.append(reinterpret_cast<char const *>(&header), sizeof(header));
+    data.append(m_key);
+    data.resize(padded(data.size()), '\0');
+    data.append(reinterpret_cast<char const *>(sites.data()), sites.size() * sizeof(SiteRecord));
+    data.append(reinterpret_cast<char const *>(macros.data()), macros.size() * sizeof(MacroRecord));
+    data.append(reinterpret_cast<char const *>(pins.data()), pins.size() * sizeof(PinRecord));
+    data.append(strings);
+    data.resize(padded(data.size()), '\0');
+
+    m_buffer.assign(data.size() / sizeof(uint64_t), 0);
+    std::memcpy(m_buffer.data(), data.data(), data.size());
+
+    delete m_file; m_file = nullptr;
+    bool attached = this->attach(std::string_view(reinterpret_cast<char const *>(m_buffer.data()),
+                                                  m_buffer.size() * sizeof(uint64_t)));
+    assertion_check (attached);
+}
+
+/**
+ * @brief Point the Records into the Library Data
+ *
+ * Counts and offsets are checked once here, the accessors trust them.
+ *
+ * @param data Library Data, aligned to Words
+ * @return bool False if the Data is damaged, outdated or for another File
+ */
+bool LefLibrary::attach(std::string_view const & data)
+{
+    if (data.size() < sizeof(Header)){
+        return false;
+    }
+
+    Header const * header = reinterpret_cast<Header const *>(data.data());
+    if (std::memcmp(header->magic, s_magic, sizeof(header->magic)) != 0 ||
+        header->version != s_version ||
+        header->byte_order != s_byte_order ||
+        header->layout != get_layout() ||
+        header->key_size != m_key.size()){
+        return false;
+    }
+
+    size_t pos = sizeof(Header);
+    if (data.size() - pos < padded(header->key_size) ||
+        data.substr(pos, header->key_size) != m_key){
+        return false;
+    }
+    pos += padded(header->key_size);
+
+    // Bounded first, so the sizes below can not overflow
+    size_t remaining = data.size() - pos;
+    if (header->num_sites > remaining / sizeof(SiteRecord) ||
+        header->num_macros > remaining / sizeof(MacroRecord) ||
+        header->num_pins > remaining / sizeof(PinRecord) ||
+        header->strings_size > remaining){
+        return false;
+    }
+    size_t records = header->num_sites * sizeof(SiteRecord) +
+                     header->num_macros * sizeof(MacroRecord) +
+                     header->num_pins * sizeof(PinRecord);
+    if (records + header->strings_size != remaining || header->strings_size == 0){
+        return false;
+    }
+
+    SiteRecord const * sites = reinterpret_cast<SiteRecord const *>(data.data() + pos);
+    MacroRecord const * macros = reinterpret_cast<MacroRecord const *>(sites + header->num_sites);
+    PinRecord const * pins = reinterpret_cast<PinRecord const *>(macros + header->num_macros);
+    char const * strings = reinterpret_cast<char const *>(pins + header->num_pins);
+
+    if (strings[header->strings_size - 1] != '\0'){
+        return false;
+    }
+    for (size_t i = 0; i < header->num_sites; ++i){
+        if (sites[i].site_class >= header->strings_size){
+            return false;
+        }
+    }
+    for (size_t i = 0; i < header->num_macros; ++i){
+        if (macros[i].name >= header->strings_size ||
+            macros[i].first_pin > header->num_pins ||
+            macros[i].num_pins > header->num_pins - macros[i].first_pin){
+            return false;
+        }
+    }
+    for (size_t i = 0; i < header->num_pins; ++i){
+        if (pins[i].name >= header->strings_size || pins[i].direction >= header->strings_size){
+            return false;
+        }
+    }
+
+    m_header = header;
+    m_sites = sites;
+    m_macros = macros;
+    m_pins = pins;
+    m_strings = strings;
+
+    return true;
+}
+
+/**
+ * @brief Get a String of the Pool
+ *
+ * @param offset Offset into the Pool
+ * @return std::string_view
+ */
+std::string_view LefLibrary::get_string(uint64_t const offset) const
+{
+    return std::string_view(m_strings + offset);
+}
+
+/**
+ * @brief Get the Database Units, zero if the File defines none
+ *
+ * @return size_t
+ */
+size_t LefLibrary::get_database_units() const
+{
+    nullpointer_check (m_header);
+
+    return m_header->database_units;
+}
+
+/**
+ * @brief Find the first Site of a Class
+ *
+ * @param site_class Class of the Site
+ * @return long Site, negative if not found
+ */
+long LefLibrary::find_site(std::string const & site_class) const
+{
+    nullpointer_check (m_header);
+
+    for (size_t i = 0; i < m_header->num_sites; ++i){
+        if (this->get_string(m_sites[i].site_class) == site_class){
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * @brief Get the Height of a Site
+ *
+ * @param site Site
+ * @return double Microns
+ */
+double LefLibrary::get_site_height(size_t const site) const
+{
+    assertion_check (site < m_header->num_sites);
+
+    return m_sites[site].size_y;
+}
+
+/**
+ * @brief Find a Macro by Name
+ *
+ * @param name Name of the Macro
+ * @return long Macro, negative if not found
+ */
+long LefLibrary::find_macro(std::string_view const & name) const
+{
+    nullpointer_check (m_header);
+
+    MacroRecord const * end = m_macros + m_header->num_macros;
+    MacroRecord const * itor = std::lower_bound(m_macros, end, name,
+        [this](MacroRecord const & macro, std::string_view const & val){
+            return this->get_string(macro.name) < val;
+        });
+
+    if (itor == end || this->get_string(itor->name) != name){
+        return -1;
+    }
+
+    return itor - m_macros;
+}
+
+/**
+ * @brief Get the Width of a Macro
+ *
+ * @param macro Macro
+ * @return double Microns
+ */
+double LefLibrary::get_macro_width(size_t const macro) const
+{
+    assertion_check (macro < m_header->num_macros);
+
+    return m_macros[macro].size_x;
+}
+
+/**
+ * @brief Get the Height of a Macro
+ *
+ * @param macro Macro
+ * @return double Microns
+ */
+double LefLibrary::get_macro_height(size_t const macro) const
+{
+    assertion_check (macro < m_header->num_macros);
+
+    return m_macros[macro].size_y;
+}
+
+/**
+ * @brief Get the Number of Pins of a Macro
+ *
+ * @param macro Macro
+ * @return size_t
+ */
+size_t LefLibrary::get_num_pins(size_t const macro) const
+{
+    assertion_check (macro < m_header->num_macros);
+
+    return m_macros[macro].num_pins;
+}
+
+/**
+ * @brief Get the Name of a Pin
+ *
+ * @param macro Macro
+ * @param pin Pin of the Macro
+ * @return std::string_view
+ */
+std::string_view LefLibrary::get_pin_name(size_t const macro, size_t const pin) const
+{
+    assertion_check (pin < this->get_num_pins(macro));
+
+    return this->get_string(m_pins[m_macros[macro].first_pin + pin].name);
+}
+
+/**
+ * @brief Get the Direction of a Pin
+ *
+ * @param macro Macro
+ * @param pin Pin of the Macro
+ * @return std::string_view
+ */
+std::string_view LefLibrary::get_pin_direction(size_t const macro, size_t const pin) const
+{
+    assertion_check (pin < this->get_num_pins(macro));
+
+    return this->get_string(m_pins[m_macros[macro].first_pin + pin].direction);
+}
+
+/**
+ * @brief Get the Shape of a Pin
+ *
+ * @param macro Macro
+ * @param pin Pin of the Macro
+ * @return PinShape
+ */
+LefLibrary::PinShape LefLibrary::get_pin_shape(size_t const macro, size_t const pin) const
+{
+    assertion_check (pin < this->get_num_pins(macro));
+
+    return m_pins[m_macros[macro].first_pin + pin].shape;
+}
@@ -0,0 +1,165 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : lef_library.hpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : Compact LEF Library shared between Runs
+//==================================================================
+#ifndef LEF_LIBRARY_HPP
+#define LEF_LIBRARY_HPP
+
+#include <object.hpp>
+#include <lefdefIO.h>
+#include <mapped_file.hpp>
+#include <logger.hpp>
+#include <exception.hpp>
+#include <utils.hpp>
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <cstdint>
+#include <cstring>
+
+#include <boost/filesystem.hpp>
+
+namespace Placer {
+
+/**
+ * @class LefLibrary
+ * @brief The part of a LEF file the placer reads: database units, sites,
+ *        macro sizes and pin names, directions and shapes. Records have a
+ *        fixed size and point into one string pool, the cached file is
+ *        used in place through a read-only mapping, so concurrent runs
+ *        share the pages of a library. Macros are sorted by name and found
+ *        by binary search.
+ *
+ * Records are stored in host byte order and layout, the header tags both
+ * and libraries written by another kind of host are rebuilt.
+ *
+ * Libraries loaded by a batch before forking its jobs are registered as
+ * shared, jobs find them by file and never release them.
+ */
+class LefLibrary: public virtual Object {
+public:
+    /**
+     * @brief Bounding Box of all Port Rectangles of a Pin, in Microns
+     */
+    struct PinShape {
+        double lx;
+        double ly;
+        double ux;
+        double uy;
+    };
+
+    LefLibrary(std::string const & filename);
+
+    virtual ~LefLibrary();
+
+    LefLibrary(LefLibrary const &) = delete;
+    LefLibrary& operator= (LefLibrary const &) = delete;
+
+    bool is_enabled() const;
+
+    static void share(LefLibrary* library);
+    static LefLibrary* find_shared(std::string const & filename);
+    bool is_shared() const;
+
+    void read();
+    bool load();
+    void store();
+    void digest(Circuit::Circuit & circuit);
+
+    size_t get_database_units() const;
+
+    long find_site(std::string const & site_class) const;
+    double get_site_height(size_t const site) const;
+
+    long find_macro(std::string_view const & name) const;
+    double get_macro_width(size_t const macro) const;
+    double get_macro_height(size_t const macro) const;
+
+    size_t get_num_pins(size_t const macro) const;
+    std::string_view get_pin_name(size_t const macro, size_t const pin) const;
+    std::string_view get_pin_direction(size_t const macro, size_t const pin) const;
+    PinShape get_pin_shape(size_t const macro, size_t const pin) const;
+
+private:
+    static constexpr char s_magic[] = "SMTPLEF1";
+    static constexpr uint64_t s_version = 2;
+    static constexpr uint64_t s_byte_order = 0x0102030405060708ULL;
+
+    struct Header {
+        char magic[8];
+        uint64_t version;
+        uint64_t byte_order;
+        uint64_t layout;
+        uint64_t key_size;
+        uint64_t database_units;
+        uint64_t num_sites;
+        uint64_t num_macros;
+        uint64_t num_pins;
+        uint64_t strings_size;
+    };
+
+    struct SiteRecord {
+        uint64_t site_class;
+        double size_x;
+        double size_y;
+    };
+
+    struct MacroRecord {
+        uint64_t name;
+        double size_x;
+        double size_y;
+        uint64_t first_pin;
+        uint64_t num_pins;
+    };
+
+    struct PinRecord {
+        uint64_t name;
+        uint64_t direction;
+        PinShape shape;
+    };
+
+    static std::map<std::string, LefLibrary*> s_shared;
+
+    Utils::Logger* m_logger;
+    std::string m_filename;
+    std::string m_key;
+    bool m_shared;
+
+    // Either the mapped cache file or a library digested in this run,
+    // words keep the records aligned
+    Utils::MappedFile* m_file;
+    std::vector<uint64_t> m_buffer;
+
+    Header const * m_header;
+    SiteRecord const * m_sites;
+    MacroRecord const * m_macros;
+    PinRecord const * m_pins;
+    char const * m_strings;
+
+    std::string get_key();
+    static std::string get_shared_key(std::string const & filename);
+    std::string get_cache_filename(std::string const & key);
+
+    bool attach(std::string_view const & data);
+    std::string_view get_string(uint64_t const offset) const;
+
+    static size_t padded(size_t const size);
+    static uint64_t get_layout();
+};
+
+} /* namespace Placer */
+
+#endif /* LEF_LIBRARY_HPP */
@@ -1,4 +1,5 @@
 #include "lefdefIO.h"
+#include <thread>
 
 using std::string;
 using std::vector;
@@ -9,23 +10,107 @@ using std::endl;
 namespace Circuit { 
 
 Circuit::Circuit()
-  : lefManufacturingGrid(DBL_MIN) {};
+  : lefManufacturingGrid(DBL_MIN), 
+  defDatabase(0) {};
 
 Circuit::Circuit(vector<string>& lefStor, 
       string defFilename, string verilogFilename )
-  : lefManufacturingGrid(DBL_MIN) {
+  : lefManufacturingGrid(DBL_MIN), 
+  defDatabase(0) {
     Init( lefStor, defFilename, verilogFilename ); 
 };
 
 void Circuit::Init( vector<string>& lefStor, string defFilename, 
     string verilogFilename ) {
+  // LEF and DEF readers keep separate session state, parse both at once
+  std::thread defParser(&Circuit::ParseDef, this, defFilename);
   ParseLef(lefStor);
-  ParseDef(defFilename);
+  defParser.join();
   if( verilogFilename != "" ) {
     // ParseVerilog(verilogFilename);   
   }
 }
 
+void Circuit::InitLef( vector<string>& lefStor ) {
+  ParseLef(lefStor);
+}
+
+void Circuit::InitDef( string defFilename ) {
+  ParseDef(defFilename);
+}
+
+void Circuit::InitDef( string defFilename, DefDatabase& database ) {
+  defDatabase = &database;
+  ParseDef(defFilename);
+  defDatabase = 0;
+  database.Shrink();
+}
+
+DefDatabase::DefDatabase()
+  : unit(0), dieLx(0), dieLy(0), dieUx(0), dieUy(0), 
+  strings(1, '\0'), numInterned(0) {};
+
+uint32_t DefDatabase::Intern(const char* str) {
+  if( str == 0 || *str == '\0' ) {
+    return 0;
+  }
+
+  // keep the load factor below one half
+  if( 2 * (numInterned + 1) > internSlots.size() ) {
+    Rehash( internSlots.empty()? 1024 : 2 * internSlots.size() );
+  }
+
+  std::string_view name(str);
+  size_t mask = internSlots.size() - 1;
+  size_t slot = std::hash<std::string_view>()(name) & mask;
+  while( internSlots[slot] != 0 ) {
+    if( name == &strings[internSlots[slot]] ) {
+      return internSlots[slot];
+    }
+    slot = (slot + 1) & mask;
+  }
+
+  if( strings.size() + name.size() + 1 > UINT32_MAX ) {
+    std::cerr << "**ERROR: DEF string pool exceeds 4 GB" << endl;
+    exit(1);
+  }
+  uint32_t offset = strings.size();
+  strings.insert(strings.end(), name.begin(), name.end());
+  strings.push_back('\0');
+
+  internSlots[slot] = offset;
+  numInterned++;
+  return offset;
+}
+
+void DefDatabase::Rehash(size_t numSlots) {
+  vector<uint32_t> slots(numSlots, 0);
+  size_t mask = numSlots - 1;
+  for(auto& offset : internSlots) {
+    if( offset == 0 ) {
+      continue;
+    }
+    size_t slot = std::hash<std::string_view>()(
+        std::string_view(&strings[offset])) & mask;
+    while( slots[slot] != 0 ) {
+      slot = (slot + 1) & mask;
+    }
+    slots[slot] = offset;
+  }
+  internSlots.swap(slots);
+}
+
+void DefDatabase::Shrink() {
+  vector<uint32_t>().swap(internSlots);
+  numInterned = 0;
+
+  strings.shrink_to_fit();
+  components.shrink_to_fit();
+  pins.shrink_to_fit();
+  nets.shrink_to_fit();
+  connections.shrink_to_fit();
+}
+
 NetInfo::NetInfo( int _macroIdx, int _compIdx, int _pinIdx) 
     : macroIdx(_macroIdx), compIdx(_compIdx), pinIdx(_pinIdx) {};
 }
@@ -63,6 +63,7 @@
 #include <limits>
 #include <queue>
 #include <unordered_map>
+#include <string_view>
 
 #include <stdint.h>
 
@@ -80,6 +81,70 @@
 
 namespace Circuit {
 
+// 
+// Compact DEF storage, 
+// filled by the parser callbacks instead of keeping defi objects.
+// Names are interned into one string pool and referred to by offset,
+// components, pins and net connections are flat arrays.
+//
+class DefDatabase {
+  public:
+    struct Component {
+      uint32_t id;        // instance name
+      uint32_t name;      // LEF macro name
+      int32_t x;
+      int32_t y;
+      int32_t orient;
+      int32_t status;     // DEFI_COMPONENT_*, 0 if not given
+    };
+
+    struct Pin {
+      uint32_t name;
+      uint32_t direction;
+      int32_t numPorts;
+      int32_t isPlaced;   // placement of the first port
+      int32_t x;
+      int32_t y;
+      int32_t orient;
+    };
+
+    struct Net {
+      uint32_t name;
+      uint32_t firstConnection;
+      uint32_t numConnections;
+    };
+
+    struct Connection {
+      uint32_t instance;
+      uint32_t pin;
+    };
+
+    DefDatabase();
+
+    std::string designName;
+    double unit;
+    int dieLx, dieLy, dieUx, dieUy;
+
+    std::vector<Component> components;
+    std::vector<Pin> pins;
+    std::vector<Net> nets;
+    std::vector<Connection> connections;
+
+    // offset 0 is the empty string
+    uint32_t Intern(const char* str);
+    const char* String(uint32_t offset) const { return &strings[offset]; }
+
+    // drops the intern index once parsing is done
+    void Shrink();
+
+  private:
+    std::vector<char> strings;
+    std::vector<uint32_t> internSlots;  // open addressing, 0 is empty
+    size_t numInterned;
+
+    void Rehash(size_t numSlots);
+};
+
 class Circuit {
   public:
     Circuit();
@@ -92,6 +157,19 @@ class Circuit {
 
     void Init( std::vector<std::string>& lefStor, std::string defFilename, 
         std::string verilogFilename = "" );
+
+    // 
+    // LEF and DEF alone,
+    // e.g. when the LEF comes from a library cache
+    //
+    void InitLef( std::vector<std::string>& lefStor );
+    void InitDef( std::string defFilename );
+
+    // 
+    // DEF into a compact database only,
+    // the defXXXStor members below stay empty
+    //
+    void InitDef( std::string defFilename, DefDatabase& database );
    
     void WriteLef( FILE* _fout );
     void WriteDef( FILE* _fout );
@@ -163,6 +241,9 @@ class Circuit {
     std::vector<std::unordered_map<std::string, int>> defComponentPinToNet;
 
   private:
+    // set while parsing into a compact database
+    DefDatabase* defDatabase;
+
     // Parsing function
     void ParseLef(std::vector<std::string>& lefStor);
     void ParseDef(std::string filename);
@@ -42,10 +42,17 @@ MacroCircuit::MacroCircuit():
     m_plotter = new Plotter();
     m_def_utils = new DefUtils();
     m_hl_client = new HLClient();
+    m_solver_pool = new SolverPool();
+    m_variables = new VariableTable();
+    m_snapshot = new DesignSnapshot();
 
     m_circuit = nullptr;
+    m_def_database = nullptr;
+    m_db = nullptr;
     m_solutions = 0;
     m_bookshelf = nullptr;
+    m_symbols = nullptr;
+    m_objective_scope = false;
 }
 
 /**
@@ -73,12 +80,17 @@ MacroCircuit::~MacroCircuit()
         delete m_circuit; m_circuit = nullptr;
     }
 
+    if(m_def_database != nullptr){
+        delete m_def_database; m_def_database = nullptr;
+    }
+
     if(m_bookshelf != nullptr){
         delete m_bookshelf; m_bookshelf = nullptr;
     }
 
     m_tree->destroy();
     delete m_tree; m_tree = nullptr;
+    delete m_symbols; m_symbols = nullptr;
     delete m_z3_opt; m_z3_opt = nullptr;
     delete m_eval; m_eval = nullptr;
     delete m_supplement; m_supplement = nullptr;
@@ -91,6 +103,15 @@ MacroCircuit::~MacroCircuit()
     delete m_plotter; m_plotter = nullptr;
     delete m_def_utils; m_def_utils = nullptr;
     delete m_hl_client; m_hl_client = nullptr;
+    delete m_solver_pool; m_solver_pool = nullptr;
+    delete m_variables; m_variables = nullptr;
+    delete m_snapshot; m_snapshot = nullptr;
+
+    for(auto itor: m_libraries){
+        if (!itor->is_shared()){
+            delete itor; itor = nullptr;
+        }
+    }
 
     m_logger = nullptr;
 }
@@ -102,9 +123,11 @@ void MacroCircuit::build_circuit()
 {
     try {
         m_supplement->read_supplement_file();
-        std::string db_file = this->get_database_dir() + this->get_database_file();
-        m_db = new Utils::Database(db_file);
-        m_db->init_database();
+        if (this->get_store_to_db()){
+            std::string db_file = this->get_database_dir() + this->get_database_file();
+            m_db = new Utils::Database(db_file);
+            m_db->init_database();
+        }
 
         if(!this->get_def().empty() && !this->get_lef().empty()) {
            this->build_circuit_lefdef();
@@ -122,56 +145,147 @@ void MacroCircuit::build_circuit()
 
 /**
  * @brief Build Macro Circuit from LEFDEF Input Files
+ * 
+ * The parser is skipped if the snapshot cache holds the input files.
  */
 void MacroCircuit::build_circuit_lefdef()
 {
-     m_circuit = new Circuit::Circuit(this->get_lef(),
-                                      this->get_def());
-            m_tree = new Tree();
-            nullpointer_check (m_tree );
-            nullpointer_check (m_circuit);
-            this->set_design_name(m_circuit->defDesignName);
+    m_symbols = new SymbolTable();
+    m_tree = new Tree(m_symbols);
+    nullpointer_check (m_tree );
+
+    if (!m_snapshot->is_enabled() || !m_snapshot->load()){
+        this->read_libraries();
+        this->create_snapshot();
+        if (m_snapshot->is_enabled()){
+            m_snapshot->store();
+        }
 
-            this->set_def_units(m_circuit->defUnit);
-            m_logger->def_units(m_circuit->defUnit);
+        // Everything needed later is in the snapshot now
+        delete m_def_database; m_def_database = nullptr;
+    }
+    this->set_design_name(m_snapshot->design_name);
 
-            this->set_lef_units(static_cast<size_t>(m_circuit->lefUnit.databaseNumber()));
-            m_logger->lef_units(static_cast<size_t>(m_circuit->lefUnit.databaseNumber()));
+    this->set_def_units(m_snapshot->def_units);
+    m_logger->def_units(m_snapshot->def_units);
 
-            bool found = false;
-            for(auto itor: m_circuit->lefSiteStor) {
-                if(itor.siteClass() == this->get_site()){
-                    m_standard_cell_height = itor.sizeY();
-                    found = true;
-                    break;
-                }
-            }
+    this->set_lef_units(m_snapshot->lef_units);
+    m_logger->lef_units(m_snapshot->lef_units);
 
-            if(!found){
-                throw std::runtime_error("Site (" + this->get_site() + ") not found!");
-            }
-            if (!this->get_minimize_die_mode()){
-                m_layout->set_lx(m_def_utils->def_to_microns(m_circuit->defDieArea.xl()));
-                m_layout->set_ux(m_def_utils->def_to_microns(m_circuit->defDieArea.xh()));
-                m_layout->set_ly(m_def_utils->def_to_microns(m_circuit->defDieArea.yl()));
-                m_layout->set_uy(m_def_utils->def_to_microns(m_circuit->defDieArea.yh()));
-            }
+    if (!this->get_minimize_die_mode()){
+        m_layout->set_lx(m_snapshot->die_lx);
+        m_layout->set_ux(m_snapshot->die_ux);
+        m_layout->set_ly(m_snapshot->die_ly);
+        m_layout->set_uy(m_snapshot->die_uy);
+    }
 
-            this->create_macro_definitions();
-            std::thread area_estimator(&MacroCircuit::area_estimator, this);
-            area_estimator.join();
+    // Workers only read the snapshot, each one fills its own component
+    // list. Z3 terms are created under m_z3_mutex, every worker enters
+    // the context of this circuit.
+    std::thread area_estimator(&MacroCircuit::area_estimator, this);
+    std::thread macro_worker(&MacroCircuit::add_macros, this);
+    std::thread cell_worker(&MacroCircuit::add_cells, this);
+    std::thread terminal_worker(&MacroCircuit::add_terminals, this);
+    area_estimator.join();
+    macro_worker.join();
+    cell_worker.join();
+    terminal_worker.join();
 
-            m_logger->min_die_area(m_estimated_area);
+    m_logger->min_die_area(m_estimated_area);
+
+    // Fixed registration order keeps symbol IDs independent of the
+    // worker scheduling
+    for (Macro* m: m_macros){
+        m_symbols->add_macro(m);
+    }
+    for (Cell* c: m_cells){
+        m_symbols->add_cell(c);
+    }
+    for (size_t i = 0; i < m_cell_definitions.size(); ++i){
+        size_t cell = m_cell_definitions[i].cell;
+        m_symbols->add_cell_record(m_snapshot->cells[cell].id, i);
+    }
+    for (Terminal* t: m_terminals){
+        m_symbols->add_terminal(t);
+    }
+
+    this->init_tree(eLEFDEF);
+}
+
+/**
+ * @brief Resolve an Input File against the Working Directory
+ * 
+ * Saving changes into the results directory, the parser may run later.
+ * 
+ * @param file Input File
+ * @return std::string
+ */
+std::string MacroCircuit::get_input_path(std::string const & file)
+{
+    return boost::filesystem::absolute(file, this->get_working_directory()).string();
+}
+
+/**
+ * @brief Read the LEF Libraries and the DEF File
+ * 
+ * The DEF file is parsed into the compact database alongside the LEF
+ * files. Libraries a batch shared before forking are used as they are.
+ * Every other LEF file is mapped from the library cache if configured,
+ * otherwise it is parsed alone and only its library is kept.
+ */
+void MacroCircuit::read_libraries()
+{
+    std::thread def_parser(&MacroCircuit::parse_def, this);
+    for (std::string const & lef: this->get_lef()){
+        LefLibrary* shared = LefLibrary::find_shared(this->get_input_path(lef));
+        if (shared != nullptr){
+            m_libraries.push_back(shared);
+            continue;
+        }
 
-            // TODO: Fix that threads can run parallel again
-            std::thread macro_worker(&MacroCircuit::add_macros, this);
-            macro_worker.join();
-            std::thread cell_worker(&MacroCircuit::add_cells, this);
-            cell_worker.join();
-            std::thread terminal_worker(&MacroCircuit::add_terminals, this);
-            terminal_worker.join();
+        LefLibrary* library = new LefLibrary(this->get_input_path(lef));
+        nullpointer_check (library);
 
-            this->init_tree(eLEFDEF);
+        library->read();
+        m_libraries.push_back(library);
+    }
+    def_parser.join();
+}
+
+/**
+ * @brief Run the DEF Parser into the compact Database
+ * 
+ * Only components, pins and net connections are kept, special nets are
+ * dropped with the power supply.
+ */
+void MacroCircuit::parse_def()
+{
+    m_def_database = new Circuit::DefDatabase();
+    nullpointer_check (m_def_database);
+
+    Circuit::Circuit circuit;
+    circuit.InitDef(this->get_input_path(this->get_def()), *m_def_database);
+}
+
+/**
+ * @brief Run the LEF/DEF Parser
+ * 
+ * The full parser output is only needed to export LEF/DEF files, it is
+ * parsed once solutions are saved.
+ */
+void MacroCircuit::parse_lefdef()
+{
+    if (m_circuit != nullptr){
+        return;
+    }
+
+    std::vector<std::string> lef;
+    for (std::string const & file: this->get_lef()){
+        lef.push_back(this->get_input_path(file));
+    }
+
+    m_circuit = new Circuit::Circuit(lef, this->get_input_path(this->get_def()));
+    nullpointer_check (m_circuit);
 }
 
 /**
@@ -180,6 +294,7 @@ void MacroCircuit::build_circuit_lefdef()
 void MacroCircuit::build_circuit_bookshelf()
 {
       m_bookshelf = new Bookshelf();
+            m_symbols = m_bookshelf->get_symbol_table();
             m_bookshelf->read_files();
             this->set_design_name(m_bookshelf->get_design_name());
             m_estimated_area = m_bookshelf->get_estimated_area();
@@ -240,43 +355,113 @@ void MacroCircuit::init_tree(eInputFormat const type)
 }
 
 /**
- * @brief Create Macro Definitions from Parser Ouput
+ * @brief Create the Design Snapshot from Parser Ouput
  */
-void MacroCircuit::create_macro_definitions()
+void MacroCircuit::create_snapshot()
 {
     using namespace LefDefParser;
-    for(auto& itor: m_circuit->defComponentStor){
-        if(this->is_macro(itor)){
-            auto idx = m_circuit->lefMacroMap.find(itor.name());
-            assertion_check (idx != m_circuit->lefMacroMap.end());
-            lefiMacro& lef_data = m_circuit->lefMacroStor[idx->second];
-            std::vector<lefiPin> lef_pins = m_circuit->lefPinStor[idx->second];
 
+    Circuit::DefDatabase const & def = *m_def_database;
+
+    m_snapshot->design_name = def.designName;
+    m_snapshot->def_units = def.unit;
+    this->set_def_units(m_snapshot->def_units);
+
+    // Later UNITS replace earlier ones, as in the parser
+    m_snapshot->lef_units = 0;
+    for (LefLibrary* library: m_libraries){
+        if (library->get_database_units() != 0){
+            m_snapshot->lef_units = library->get_database_units();
+        }
+    }
+
+    bool found = false;
+    for (LefLibrary* library: m_libraries){
+        long site = library->find_site(this->get_site());
+        if (site >= 0){
+            m_standard_cell_height = library->get_site_height(site);
+            found = true;
+            break;
+        }
+    }
+
+    if(!found){
+        throw std::runtime_error("Site (" + this->get_site() + ") not found!");
+    }
+
+    m_snapshot->die_lx = m_def_utils->def_to_microns(def.dieLx);
+    m_snapshot->die_ux = m_def_utils->def_to_microns(def.dieUx);
+    m_snapshot->die_ly = m_def_utils->def_to_microns(def.dieLy);
+    m_snapshot->die_uy = m_def_utils->def_to_microns(def.dieUy);
+
+    for(auto& itor: def.components){
+        std::pair<LefLibrary*, size_t> lef_macro = this->find_lef_macro(def.String(itor.name));
+        LefLibrary* library = lef_macro.first;
+        size_t idx = lef_macro.second;
+
+        if(library->get_macro_height(idx) == m_standard_cell_height){
+            DesignSnapshot::CellRecord cell;
+            cell.name = def.String(itor.name);
+            cell.id = def.String(itor.id);
+            m_snapshot->cells.push_back(cell);
+        } else {
             MacroDefinition macro_definition;
-            macro_definition.name = itor.name();
-            macro_definition.id = itor.id();
-            macro_definition.width = lef_data.sizeX();                            // microns
-            macro_definition.height = lef_data.sizeY();                           // microns
-            macro_definition.lx = m_def_utils->def_to_microns(itor.placementX()); // microns
-            macro_definition.ly = m_def_utils->def_to_microns(itor.placementY()); // microns
-            macro_definition.orientation = 
-                static_cast<eOrientation>(itor.placementOrient());
-            macro_definition.is_placed = itor.isPlaced();
-            macro_definition.is_unplaced = itor.isUnplaced();
-            macro_definition.is_cover = itor.isCover();
-            macro_definition.is_fixed = itor.isFixed();
-
-            for(auto pin: lef_pins){
+            macro_definition.name = def.String(itor.name);
+            macro_definition.id = def.String(itor.id);
+            macro_definition.width = library->get_macro_width(idx);   // microns
+            macro_definition.height = library->get_macro_height(idx); // microns
+            macro_definition.lx = m_def_utils->def_to_microns(itor.x); // microns
+            macro_definition.ly = m_def_utils->def_to_microns(itor.y); // microns
+            macro_definition.orientation = static_cast<eOrientation>(itor.orient);
+            macro_definition.is_placed = itor.status == DEFI_COMPONENT_PLACED;
+            macro_definition.is_unplaced = itor.status == DEFI_COMPONENT_UNPLACED;
+            macro_definition.is_cover = itor.status == DEFI_COMPONENT_COVER;
+            macro_definition.is_fixed = itor.status == DEFI_COMPONENT_FIXED;
+
+            for(size_t pin = 0; pin < library->get_num_pins(idx); ++pin){
                 PinDefinition pin_def;
-                pin_def.parent = itor.id();
-                pin_def.name = pin.name();
-                pin_def.direction = pin.direction();
+                pin_def.parent = macro_definition.id;
+                pin_def.name = library->get_pin_name(idx, pin);
+                pin_def.direction = library->get_pin_direction(idx, pin);
 
                 macro_definition.pin_definitions.push_back(pin_def);
             }
-            m_macro_definitions.push_back(macro_definition);
+            m_snapshot->macros.push_back(macro_definition);
         }
     }
+
+    for(auto & itor: def.pins){
+        assertion_check (itor.numPorts == 1);
+
+        DesignSnapshot::TerminalRecord terminal;
+        terminal.name = def.String(itor.name);
+        terminal.direction = def.String(itor.direction);
+        terminal.is_placed = itor.isPlaced;
+        terminal.x = 0;
+        terminal.y = 0;
+        terminal.orientation = eNorth;
+        if (terminal.is_placed){
+            terminal.x = m_def_utils->def_to_microns(itor.x); // microns
+            terminal.y = m_def_utils->def_to_microns(itor.y); // microns
+            terminal.orientation = static_cast<eOrientation>(itor.orient);
+        }
+        m_snapshot->terminals.push_back(terminal);
+    }
+
+    for(auto& itor: def.nets){
+        if(itor.numConnections < 2){
+            continue;
+        }
+
+        DesignSnapshot::NetRecord net;
+        net.name = def.String(itor.name);
+        for(size_t i = 0; i < itor.numConnections; ++i){
+            Circuit::DefDatabase::Connection const & conn = def.connections[itor.firstConnection + i];
+            net.instances.push_back(def.String(conn.instance));
+            net.pins.push_back(def.String(conn.pin));
+        }
+        m_snapshot->nets.push_back(net);
+    }
 }
 
 /**
@@ -381,7 +566,7 @@ void MacroCircuit::place()
     } else {
         if (this->get_solver_backend() == eZ3){
             if (this->get_z3_shell_mode()){
-                this->solve_z3_no_api();
+                this->solve_z3_pool();
             } else if (this->get_z3_api_mode()){
                 this->solve_z3_api();
             } else {
@@ -399,15 +584,21 @@ void MacroCircuit::place()
 
 /**
  * @brief Add Macros using worker thread
+ * 
+ * Macros are registered in the symbol table once all workers joined.
  */
 void MacroCircuit::add_macros()
 {
+    PlacementContext::Scope scope(this->get_context());
+
     m_logger->start_macro_thread();
 
-    for (MacroDefinition macro_definition: m_macro_definitions){
+    for (MacroDefinition const & macro_definition: m_snapshot->macros){
         Macro* m = nullptr;
 
+        // Constructors of Macros and Pins create z3 terms
         if (macro_definition.is_fixed && !this->get_free_components()){
+            std::lock_guard<std::mutex> lock(m_z3_mutex);
             m = new Macro(macro_definition.name,
                           macro_definition.id,
                           macro_definition.width,
@@ -416,6 +607,7 @@ void MacroCircuit::add_macros()
                           macro_definition.ly,
                           macro_definition.orientation);
         } else {
+            std::lock_guard<std::mutex> lock(m_z3_mutex);
             m = new Macro(macro_definition.name,
                           macro_definition.id,
                           macro_definition.width,
@@ -425,17 +617,26 @@ void MacroCircuit::add_macros()
 
         if (this->get_minimize_die_mode()){
             if (macro_definition.pin_definitions.size() > 0){
-                Pin* p = new Pin ("center",
-                                  macro_definition.id,
-                                  e_pin_direction::eBidirectional);
+                Pin* p = nullptr;
+                {
+                    std::lock_guard<std::mutex> lock(m_z3_mutex);
+                    p = new Pin ("center",
+                                 macro_definition.id,
+                                 e_pin_direction::eBidirectional);
+                }
                 nullpointer_check(p);
                 m->add_pin(p);
             }
         } else {
-            for (PinDefinition pin_definition: macro_definition.pin_definitions){
-                Pin* p = new Pin(pin_definition.name,
-                    pin_definition.parent,
-                    Pin::string2enum(pin_definition.direction));
+            for (PinDefinition const & pin_definition: macro_definition.pin_definitions){
+                e_pin_direction direction = Pin::string2enum(pin_definition.direction);
+                Pin* p = nullptr;
+                {
+                    std::lock_guard<std::mutex> lock(m_z3_mutex);
+                    p = new Pin(pin_definition.name,
+                        pin_definition.parent,
+                        direction);
+                }
                 nullpointer_check (p);
                 m->add_pin(p);
             }
@@ -445,21 +646,29 @@ void MacroCircuit::add_macros()
         }
 
         m_macros.push_back(m);
-        m_id2macro[macro_definition.id] = m;
     }
     m_logger->end_macro_thread();
 }
 
 /**
  * @brief Add Standard-Cells using worker thread
+ * 
+ * Cells are registered in the symbol table once all workers joined. In
+ * skip cells mode only records are kept, no Cell objects are built.
  */
 void MacroCircuit::add_cells()
 {
+    PlacementContext::Scope scope(this->get_context());
+
     m_logger->start_cell_thread();
     
-    for(auto& itor: m_circuit->defComponentStor){
-        if(this->is_standard_cell(itor)){
-            this->add_cell(itor);
+    for(size_t i = 0; i < m_snapshot->cells.size(); ++i){
+        if (this->get_skip_cells()){
+            CellDefinition cell_definition;
+            cell_definition.cell = i;
+            m_cell_definitions.push_back(cell_definition);
+        } else {
+            this->add_cell(m_snapshot->cells[i]);
         }
     }
     m_logger->end_cell_thread();
@@ -467,32 +676,33 @@ void MacroCircuit::add_cells()
 
 /**
  * @brief Add Terminals using worker thread
+ * 
+ * Terminals are registered in the symbol table once all workers joined.
  */
 void MacroCircuit::add_terminals()
 {
+    PlacementContext::Scope scope(this->get_context());
+
     m_logger->start_terminal_thread();
 
-    for(auto & itor: m_circuit->defPinStor){
-        e_pin_direction direction = Pin::string2enum(itor.direction());
+    for(auto const & itor: m_snapshot->terminals){
+        e_pin_direction direction = Pin::string2enum(itor.direction);
         Terminal* tmp = nullptr;
 
-        assertion_check (itor.numPorts() == 1);
-
-        if (this->get_free_terminals()){
-            tmp = new Terminal(itor.pinName(), direction);
-        } else if (itor.pinPort(0)->isPlaced()){
-            int x = m_def_utils->def_to_microns(itor.pinPort(0)->placementX()); // microns
-            int y = m_def_utils->def_to_microns(itor.pinPort(0)->placementY()); // microns
-            eOrientation o = static_cast<eOrientation>(itor.pinPort(0)->orient());
-            tmp = new Terminal(itor.pinName(), x, y, direction, o);
-        } else {
-            tmp = new Terminal(itor.pinName(), direction);
+        {
+            std::lock_guard<std::mutex> lock(m_z3_mutex);
+            if (this->get_free_terminals()){
+                tmp = new Terminal(itor.name, direction);
+            } else if (itor.is_placed){
+                tmp = new Terminal(itor.name, itor.x, itor.y, direction, itor.orientation);
+            } else {
+                tmp = new Terminal(itor.name, direction);
+            }
         }
 
         nullpointer_check(tmp);
 
         m_terminals.push_back(tmp);
-        m_id2terminal[itor.pinName()] = tmp;
     }
     m_logger->end_terminal_thread();
 }
@@ -538,6 +748,7 @@ void MacroCircuit::save_all()
 
      if(!this->get_def().empty() && !this->get_lef().empty()) {
         m_logger->save_all(eLEFDEF);
+        this->parse_lefdef();
         for(size_t i = 0; i < m_solutions; ++i){
             std::string def_name = "placed_" + std::to_string(i) + "_" + this->get_def();
             std::string lef_name = "placed_" + std::to_string(i) + "_" + this->get_lef()[0];
@@ -570,6 +781,7 @@ void MacroCircuit::save_best()
 
     if(!this->get_def().empty() && !this->get_lef().empty()) {
         m_logger->save_best(eLEFDEF);
+        this->parse_lefdef();
         if (this->get_minimize_die_mode()){
             std::pair<size_t, size_t> best_area = m_eval->best_area();
             std::string def_name = "best_" + this->get_def();
@@ -612,113 +824,171 @@ void MacroCircuit::save_best()
  */
 void MacroCircuit::build_tree_from_lefdef()
 {
-    for(auto itor: m_circuit->defNetStor){
-        if(itor.numConnections() < 2){
-            continue;
-        }
-
-        for(size_t i = 1; i < itor.numConnections(); ++i){
-            Macro* from_m = nullptr;
-            Cell* from_c = nullptr;
-            Terminal* from_t = nullptr;
-
-            Macro* to_m = nullptr;
-            Cell* to_c = nullptr;
-            Terminal* to_t = nullptr;
-
-            std::stringstream _case;
-            if(m_id2macro.find(itor.instance(0)) != m_id2macro.end()){
-                from_m =  m_id2macro[itor.instance(0)];
-                _case << "m";
-            } else if (m_id2cell.find(itor.instance(0)) != m_id2cell.end()){
-                from_c = m_id2cell[itor.instance(0)];
-                 _case << "c";
-            } else if (std::string(itor.instance(0)) == "PIN" && m_id2terminal.find(itor.pin(0)) != m_id2terminal.end()){
-                from_t = m_id2terminal[itor.pin(0)];
-                 _case << "t";
+    if (this->get_skip_cells()){
+        this->build_tree_skip_cells();
+        return;
+    }
+
+    for(auto const & itor: m_snapshot->nets){
+        size_t net = m_tree->insert_net(itor.name);
+
+        for(size_t i = 0; i < itor.instances.size(); ++i){
+            std::string const & instance = itor.instances[i];
+            std::string const & pin = itor.pins[i];
+            Macro* m = m_symbols->find_macro(instance);
+            Cell* c = (m == nullptr) ? m_symbols->find_cell(instance) : nullptr;
+            Terminal* t = (instance == "PIN") ? m_symbols->find_terminal(pin) : nullptr;
+
+            if(m != nullptr){
+                m_tree->insert_pin<Macro>(net, m, pin);
+            } else if (c != nullptr){
+                m_tree->insert_pin<Cell>(net, c, pin);
+            } else if (t != nullptr){
+                m_tree->insert_pin<Terminal>(net, t, pin);
             } else {
-                std::cout << itor.instance(0) << " " << itor.pin(0) << std::endl;
-                notimplemented_check();
+                throw PlacerException("Unresolved Pin " + pin + " of Instance " + instance
+                                      + " in Net " + itor.name);
             }
+        }
+    }
+}
+
+/**
+ * @brief Build Connectivity Tree without Standard-Cells
+ * 
+ * Nets keep their Macro and Terminal pins only. A Cell whose nets reach
+ * Macro or Terminal pins over at least two different nets becomes an
+ * affinity net between all of these pins. Equal affinities are merged,
+ * the number of Cells behind an affinity is its net weight.
+ */
+void MacroCircuit::build_tree_skip_cells()
+{
+    struct PinRef {
+        Macro* macro;
+        Terminal* terminal;
+        std::string pin;
+    };
+
+    std::vector<PinRef> pins;
+    std::map<std::pair<void*, std::string>, size_t> pin_ids;
+    std::vector<std::string> net_names;
+    std::vector<size_t> net_start(1, 0);
+    std::vector<size_t> net_pins;
+    std::vector<std::vector<size_t>> cell_nets(m_cell_definitions.size());
+
+    auto pin_id = [&](Macro* m, Terminal* t, std::string const & pin){
+        void* owner = (m != nullptr) ? static_cast<void*>(m) : static_cast<void*>(t);
+        auto insert = pin_ids.insert(std::make_pair(std::make_pair(owner, pin), pins.size()));
+        if (insert.second){
+            pins.push_back(PinRef{m, t, pin});
+        }
+        return insert.first->second;
+    };
 
-            if(m_id2macro.find(itor.instance(i)) != m_id2macro.end()){
-                  _case << "m";
-                  to_m = m_id2macro[itor.instance(i)];
-            } else if (m_id2cell.find(itor.instance(i)) != m_id2cell.end()){
-                to_c = m_id2cell[itor.instance(i)];
-                _case << "c";
-            } else if (std::string(itor.instance(i)) == "PIN" && m_id2terminal.find(itor.pin(i)) != m_id2terminal.end()){
-                to_t = m_id2terminal[itor.pin(i)];
-                  _case << "t";
+    for(auto const & itor: m_snapshot->nets){
+        size_t net = net_names.size();
+        net_names.push_back(itor.name);
+
+        for(size_t i = 0; i < itor.instances.size(); ++i){
+            std::string const & instance = itor.instances[i];
+            std::string const & pin = itor.pins[i];
+            Macro* m = m_symbols->find_macro(instance);
+            Terminal* t = (instance == "PIN") ? m_symbols->find_terminal(pin) : nullptr;
+
+            if (m != nullptr || t != nullptr){
+                net_pins.push_back(pin_id(m, t, pin));
             } else {
-                notimplemented_check();
+                long record = m_symbols->find_cell_record(instance);
+                if (record < 0){
+                    throw PlacerException("Unresolved Pin " + pin + " of Instance " + instance
+                                          + " in Net " + itor.name);
+                }
+                std::vector<size_t>& nets = cell_nets[record];
+                if (nets.empty() || nets.back() != net){
+                    nets.push_back(net);
+                }
             }
+        }
+        net_start.push_back(net_pins.size());
+    }
 
-            if(_case.str() == "mm"){
-                nullpointer_check (from_m);
-                nullpointer_check (to_m);
-                m_tree->insert_edge<Macro, Macro>(from_m, to_m, itor.pin(0), itor.pin(i), itor.name());
-
-            } else if (_case.str() == "mc"){
-                nullpointer_check (from_m);
-                nullpointer_check (to_c);
-                m_tree->insert_edge<Macro, Cell>(from_m, to_c, itor.pin(0), itor.pin(i), itor.name());
-
-            } else if (_case.str() == "mt"){
-                  nullpointer_check (from_m);
-                  nullpointer_check (to_t );
-                m_tree->insert_edge<Macro, Terminal>(from_m, to_t, itor.pin(0), itor.pin(i), itor.name());
-
-            } else if (_case.str() == "cm"){
-                nullpointer_check (from_m);
-                nullpointer_check (to_m);
-                m_tree->insert_edge<Cell, Macro>(from_c, to_m, itor.pin(0), itor.pin(i), itor.name());
-
-            } else if (_case.str() == "cc"){
-                nullpointer_check (from_c);
-                nullpointer_check (to_c);
-                m_tree->insert_edge<Cell, Cell>(from_c, to_c, itor.pin(0), itor.pin(i), itor.name());
-
-            } else if (_case.str() == "ct"){
-                nullpointer_check (from_c);
-                nullpointer_check (to_t);
-                m_tree->insert_edge<Cell, Terminal>(from_c, to_t, itor.pin(0), itor.pin(i), itor.name());
-
-            } else if (_case.str() == "tm"){
-                nullpointer_check (from_t);
-                nullpointer_check (to_m);
-                m_tree->insert_edge<Terminal, Macro>(from_t, to_m, itor.pin(0), itor.pin(i), itor.name());
-
-            } else if (_case.str() == "tc"){
-                nullpointer_check (from_t);
-                nullpointer_check (to_c);
-                m_tree->insert_edge<Terminal, Cell>(from_t, to_c, itor.pin(0), itor.pin(i), itor.name());
-
-            } else if (_case.str() == "tt"){
-                nullpointer_check (from_t);
-                nullpointer_check (to_t);
-                m_tree->insert_edge<Terminal, Terminal>(from_t, to_t, itor.pin(0), itor.pin(i), itor.name());
+    auto insert_pin = [&](size_t const net, size_t const id){
+        if (pins[id].macro != nullptr){
+            m_tree->insert_pin<Macro>(net, pins[id].macro, pins[id].pin);
+        } else {
+            m_tree->insert_pin<Terminal>(net, pins[id].terminal, pins[id].pin);
+        }
+    };
 
-            } else {
-                notimplemented_check();
+    // Direct Connections
+    for (size_t net = 0; net < net_names.size(); ++net){
+        if (net_start[net + 1] - net_start[net] < 2){
+            continue;
+        }
+        size_t tree_net = m_tree->insert_net(net_names[net]);
+        for (size_t i = net_start[net]; i < net_start[net + 1]; ++i){
+            insert_pin(tree_net, net_pins[i]);
+        }
+    }
+
+    // Connections through a single Cell
+    std::map<std::vector<size_t>, size_t> affinities;
+    for (std::vector<size_t> const & nets: cell_nets){
+        std::vector<size_t> reached;
+        size_t bridged_nets = 0;
+
+        for (size_t net: nets){
+            if (net_start[net + 1] == net_start[net]){
+                continue;
             }
+            bridged_nets++;
+            reached.insert(reached.end(),
+                           net_pins.begin() + net_start[net],
+                           net_pins.begin() + net_start[net + 1]);
+        }
+        if (bridged_nets < 2){
+            continue;
+        }
+
+        std::sort(reached.begin(), reached.end());
+        reached.erase(std::unique(reached.begin(), reached.end()), reached.end());
+
+        std::set<void*> owners;
+        for (size_t id: reached){
+            owners.insert((pins[id].macro != nullptr) ? static_cast<void*>(pins[id].macro) :
+                                                        static_cast<void*>(pins[id].terminal));
+        }
+        if (owners.size() < 2){
+            continue;
+        }
+        affinities[reached]++;
+    }
+
+    size_t affinity_id = 0;
+    for (auto const & itor: affinities){
+        size_t tree_net = m_tree->insert_net("cell_affinity_" + std::to_string(affinity_id++), itor.second);
+        for (size_t id: itor.first){
+            insert_pin(tree_net, id);
         }
     }
+
+    m_logger->skip_cells(m_cell_definitions.size(), affinities.size());
 }
 
 /**
  * @brief Add single cell to macrocircuit
  * 
- * @param cmp Cell to add
+ * @param cell Cell to add
  */
-void MacroCircuit::add_cell(LefDefParser::defiComponent const & cmp)
+void MacroCircuit::add_cell(DesignSnapshot::CellRecord const & cell)
 {
-    std::string name = cmp.name();
-    std::string id   = cmp.id();
-
-    Cell* c = new Cell(name, id);
+    Cell* c = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_z3_mutex);
+        c = new Cell(cell.name, cell.id);
+    }
+    nullpointer_check(c);
     m_cells.push_back(c);
-    m_id2cell[id] = c;
 }
 
 /**
@@ -816,39 +1086,22 @@ void MacroCircuit::write_lef(std::string const & name)
 }
 
 /**
- * @brief Check if component is macro
+ * @brief Find the LEF Macro of a Component
  * 
- * @param macro Component to check
- * @return bool
- */
-bool MacroCircuit::is_macro(LefDefParser::defiComponent const & macro)
-{
-    try {
-        auto idx = m_circuit->lefMacroMap.find(macro.name());
-        assertion_check (idx != m_circuit->lefMacroMap.end());
-
-        LefDefParser::lefiMacro& lef_data = m_circuit->lefMacroStor[idx->second];
-
-        return lef_data.sizeY() != m_standard_cell_height;
-
-    } catch(std::exception const & exp){
-        throw PlacerException(exp.what());
-    }
-}
-
-/**
- * @brief Check if component is standard cell
+ * Later libraries replace macros of earlier ones, as in the parser.
  * 
- * @param cell Cell to check
- * @return bool
+ * @param name Name of the LEF Macro
+ * @return std::pair< Placer::LefLibrary*, size_t > Library and Macro
  */
-bool MacroCircuit::is_standard_cell(LefDefParser::defiComponent const & cell)
+std::pair<LefLibrary*, size_t> MacroCircuit::find_lef_macro(std::string const & name)
 {
-    auto idx = m_circuit->lefMacroMap.find(cell.name());
-    assertion_check (idx != m_circuit->lefMacroMap.end());
-    LefDefParser::lefiMacro& lef_data = m_circuit->lefMacroStor[idx->second];
-
-    return lef_data.sizeY() == m_standard_cell_height;
+    for (auto itor = m_libraries.rbegin(); itor != m_libraries.rend(); ++itor){
+        long macro = (*itor)->find_macro(name);
+        if (macro >= 0){
+            return std::make_pair(*itor, static_cast<size_t>(macro));
+        }
+    }
+    throw std::runtime_error("LEF Macro (" + name + ") not found!");
 }
 
 /**
@@ -879,9 +1132,11 @@ void MacroCircuit::dump(std::ostream& stream)
  */
 void MacroCircuit::area_estimator()
 {
+    PlacementContext::Scope scope(this->get_context());
+
     m_estimated_area = 0;
 
-    for (MacroDefinition macro_definition: m_macro_definitions){
+    for (MacroDefinition const & macro_definition: m_snapshot->macros){
         m_estimated_area += (macro_definition.width * macro_definition.height);
     }
 
@@ -929,8 +1184,15 @@ void MacroCircuit::config_z3()
     z3::set_param("verbose", 0);
     z3::set_param("smt.auto_config", false);
     z3::set_param("smt.arith.solver", 5);
-    z3::set_param("smt.threads", 3);
-    z3::set_param("parallel.enable", true);
+    if (this->get_portfolio() || this->get_z3_shell_mode()){
+        // Every solver pool worker occupies a core on its own, the
+        // optimizer parameters do not accept the thread count
+        z3::set_param("smt.threads", 1);
+        z3::set_param("parallel.enable", false);
+    } else {
+        z3::set_param("smt.threads", 3);
+        z3::set_param("parallel.enable", true);
+    }
     
     z3::params param(m_z3_ctx);
     //param.set(":opt.solution_prefix", "intermediate_result");
@@ -959,8 +1221,46 @@ void MacroCircuit::config_z3()
 
 /**
  * @brief Run SMT encoding
+ *
+ * In incremental mode the objectives are placed in their own solver scope
+ * on top of the base constraints, so they can be exchanged without
+ * re-encoding the design.
  */
 void MacroCircuit::run_encoding()
+{
+    this->encode_base_constraints();
+
+    if (this->get_incremental()){
+        this->push_objective_scope();
+    }
+    this->encode_objectives();
+    this->build_variable_table();
+}
+
+/**
+ * @brief Assign a Slot to every Expression a Solution is read from
+ */
+void MacroCircuit::build_variable_table()
+{
+    m_variables->clear();
+
+    if (this->get_minimize_die_mode()){
+        m_variables->add_die(m_layout->get_ux(), m_layout->get_uy());
+    }
+    for (Component* component: m_components){
+        m_variables->add_component(component);
+    }
+    if (this->get_free_terminals()){
+        for (Terminal* terminal: m_terminals){
+            m_variables->add_terminal(terminal);
+        }
+    }
+}
+
+/**
+ * @brief Encode the placement constraints which hold for every objective
+ */
+void MacroCircuit::encode_base_constraints()
 {
     if (this->get_free_terminals()){
         //this->encode_terminals_non_overlapping();
@@ -978,7 +1278,11 @@ void MacroCircuit::run_encoding()
         this->encode_components_inside_die(e2D);
         m_z3_opt->add(m_components_inside_die.simplify());
 
-        this->encode_components_non_overlapping(e2D);
+        if (this->get_symmetry_breaking()){
+            this->encode_components_non_overlapping_symmetric(e2D);
+        } else {
+            this->encode_components_non_overlapping(e2D);
+        }
         m_z3_opt->add(m_components_non_overlapping.simplify());
 
         this->encode_layout_on_grid();
@@ -1007,7 +1311,13 @@ void MacroCircuit::run_encoding()
         }
         m_z3_opt->add(z3::mk_and(clauses));
     }
+}
 
+/**
+ * @brief Encode the optimization targets
+ */
+void MacroCircuit::encode_objectives()
+{
     if (this->get_minimize_die_mode()){
         //m_z3_opt->minimize(m_layout->get_ux() * m_layout->get_uy());
         m_z3_opt->minimize(m_layout->get_ux());
@@ -1022,6 +1332,64 @@ void MacroCircuit::run_encoding()
     //m_z3_opt->minimize(m_hpwl_cost_function);
 }
 
+/**
+ * @brief Open a solver scope for objectives and blocking clauses
+ */
+void MacroCircuit::push_objective_scope()
+{
+    try {
+        assertion_check (!m_objective_scope);
+
+        m_z3_opt->push();
+        m_objective_scope = true;
+        m_logger->push_objective_scope();
+    } catch (z3::exception const & exp){
+        throw PlacerException(exp.msg());
+    }
+}
+
+/**
+ * @brief Drop objectives and blocking clauses, the base constraints and
+ *        everything the solver learned about them stay
+ */
+void MacroCircuit::pop_objective_scope()
+{
+    try {
+        assertion_check (m_objective_scope);
+
+        m_z3_opt->pop();
+        m_objective_scope = false;
+        m_logger->pop_objective_scope();
+    } catch (z3::exception const & exp){
+        throw PlacerException(exp.msg());
+    }
+}
+
+/**
+ * @brief Create a clause excluding the placement of the given model
+ *
+ * @param m The model to exclude
+ * @return z3::expr
+ */
+z3::expr MacroCircuit::block_solution(z3::model const & m)
+{
+    z3::expr_vector clauses(m_z3_ctx);
+
+    for (Component* component: m_components){
+        if (!component->is_free()){
+            continue;
+        }
+        clauses.push_back(component->get_lx() != m.eval(component->get_lx(), true));
+        clauses.push_back(component->get_ly() != m.eval(component->get_ly(), true));
+        clauses.push_back(component->get_orientation() != m.eval(component->get_orientation(), true));
+    }
+
+    if (clauses.empty()){
+        return m_encode->get_flag(false);
+    }
+    return z3::mk_or(clauses);
+}
+
 /**
  * @brief Ensure all Components are placed within the die
  * 
@@ -1317,6 +1685,141 @@ void MacroCircuit::encode_components_non_overlapping(eRotation const type)
     }
 }
 
+/**
+ * @brief Ensure all Components are placed non overlapping, encoding every
+ *        unordered pair only once
+ *
+ * The orientation dependent bounding box of each component is resolved once
+ * and shared by all pairs it takes part in. Pairs of fixed components which
+ * are proven to be disjoint are not encoded at all.
+ *
+ * @param type Rotation degree of freedom
+ */
+void MacroCircuit::encode_components_non_overlapping_symmetric(eRotation const type)
+{
+    try {
+        z3::expr_vector clauses(m_z3_ctx);
+        z3::expr_vector box_lx(m_z3_ctx);
+        z3::expr_vector box_ly(m_z3_ctx);
+        z3::expr_vector box_ux(m_z3_ctx);
+        z3::expr_vector box_uy(m_z3_ctx);
+
+        for (Component* itor: m_components){
+            if (!itor->is_free()){
+                eOrientation o = static_cast<eOrientation>(itor->get_orientation().get_numeral_uint());
+                box_lx.push_back(itor->get_lx(o).simplify());
+                box_ly.push_back(itor->get_ly(o).simplify());
+                box_ux.push_back(itor->get_ux(o).simplify());
+                box_uy.push_back(itor->get_uy(o).simplify());
+            } else if (type == eRotation::e2D){
+                box_lx.push_back(z3::ite(itor->is_N(), itor->get_lx(eNorth), itor->get_lx(eWest)));
+                box_ly.push_back(z3::ite(itor->is_N(), itor->get_ly(eNorth), itor->get_ly(eWest)));
+                box_ux.push_back(z3::ite(itor->is_N(), itor->get_ux(eNorth), itor->get_ux(eWest)));
+                box_uy.push_back(z3::ite(itor->is_N(), itor->get_uy(eNorth), itor->get_uy(eWest)));
+            } else if (type == eRotation::e4D){
+                box_lx.push_back(z3::ite(itor->is_N(), itor->get_lx(eNorth),
+                                 z3::ite(itor->is_W(), itor->get_lx(eWest),
+                                 z3::ite(itor->is_S(), itor->get_lx(eSouth), itor->get_lx(eEast)))));
+                box_ly.push_back(z3::ite(itor->is_N(), itor->get_ly(eNorth),
+                                 z3::ite(itor->is_W(), itor->get_ly(eWest),
+                                 z3::ite(itor->is_S(), itor->get_ly(eSouth), itor->get_ly(eEast)))));
+                box_ux.push_back(z3::ite(itor->is_N(), itor->get_ux(eNorth),
+                                 z3::ite(itor->is_W(), itor->get_ux(eWest),
+                                 z3::ite(itor->is_S(), itor->get_ux(eSouth), itor->get_ux(eEast)))));
+                box_uy.push_back(z3::ite(itor->is_N(), itor->get_uy(eNorth),
+                                 z3::ite(itor->is_W(), itor->get_uy(eWest),
+                                 z3::ite(itor->is_S(), itor->get_uy(eSouth), itor->get_uy(eEast)))));
+            } else {
+                notsupported_check("Only 2D and 4D Rotation are supported!");
+            }
+        }
+
+        std::set<std::pair<size_t, size_t>> overlapping = this->find_overlapping_fixed_components();
+        size_t pruned = 0;
+
+        for (size_t i = 0; i < m_components.size(); ++i){
+            for (size_t j = i + 1; j < m_components.size(); ++j){
+                if (!m_components[i]->is_free() && !m_components[j]->is_free() &&
+                    (overlapping.find(std::make_pair(i, j)) == overlapping.end())){
+                    pruned++;
+                    continue;
+                }
+
+                z3::expr_vector relation(m_z3_ctx);
+                relation.push_back(m_encode->le(box_ux[i], box_lx[j])); ///< Left
+                relation.push_back(m_encode->le(box_ux[j], box_lx[i])); ///< Right
+                relation.push_back(m_encode->le(box_uy[i], box_ly[j])); ///< Below
+                relation.push_back(m_encode->le(box_uy[j], box_ly[i])); ///< Upper
+
+                clauses.push_back(z3::mk_or(relation));
+            }
+        }
+        m_logger->encode_non_overlapping_pairs(clauses.size(), pruned);
+
+        m_components_non_overlapping = z3::mk_and(clauses);
+    } catch (z3::exception const & exp){
+        throw PlacerException(exp.msg());
+    }
+}
+
+/**
+ * @brief Sweep over the fixed components along x and collect all pairs
+ *        whose bounding boxes intersect
+ *
+ * @return std::set<std::pair<size_t, size_t>> Index pairs (i < j) into m_components
+ */
+std::set<std::pair<size_t, size_t>> MacroCircuit::find_overlapping_fixed_components()
+{
+    struct Box {
+        size_t idx;
+        long lx;
+        long ly;
+        long ux;
+        long uy;
+    };
+
+    std::vector<Box> boxes;
+    for (size_t i = 0; i < m_components.size(); ++i){
+        Component* c = m_components[i];
+        if (c->is_free()){
+            continue;
+        }
+        long lx = c->get_lx_numeral();
+        long ly = c->get_ly_numeral();
+        long w  = c->get_width_numeral();
+        long h  = c->get_height_numeral();
+
+        switch (c->get_orientation().get_numeral_uint()){
+            case eNorth: boxes.push_back({i, lx,     ly,     lx + w, ly + h}); break;
+            case eWest:  boxes.push_back({i, lx - h, ly,     lx,     ly + w}); break;
+            case eSouth: boxes.push_back({i, lx - w, ly - h, lx,     ly    }); break;
+            case eEast:  boxes.push_back({i, lx,     ly - w, lx + h, ly    }); break;
+            default: notsupported_check("Only 2D and 4D Rotation are supported!");
+        }
+    }
+
+    std::sort(boxes.begin(), boxes.end(), [](Box const & a, Box const & b){
+        return a.lx < b.lx;
+    });
+
+    std::set<std::pair<size_t, size_t>> retval;
+    std::vector<Box> active;
+    for (Box const & box: boxes){
+        active.erase(std::remove_if(active.begin(), active.end(), [&box](Box const & a){
+            return a.ux <= box.lx;
+        }), active.end());
+
+        for (Box const & a: active){
+            if ((a.ly < box.uy) && (box.ly < a.uy)){
+                retval.insert(std::minmax(a.idx, box.idx));
+            }
+        }
+        active.push_back(box);
+    }
+
+    return retval;
+}
+
 /**
  * @brief Encode Terminals to be on the Dies frontier
  * 
@@ -1502,7 +2005,14 @@ void MacroCircuit::solve_z3_api()
                this->process_results(m);
 
                 if(/*this->get_pareto_optimizer() &&*/  (m_solutions < this->get_max_solutions())){
-                    m_logger->pareto_step();
+                    // Pareto fronts are enumerated by Z3 itself, every other
+                    // optimizer would return the same optimum again
+                    if (this->get_incremental() && !this->get_pareto_optimizer()){
+                        m_logger->block_solution(m_solutions);
+                        m_z3_opt->add(this->block_solution(m));
+                    } else {
+                        m_logger->pareto_step();
+                    }
                     sat = m_z3_opt->check();
 
                 } else {
@@ -1510,6 +2020,10 @@ void MacroCircuit::solve_z3_api()
                 }
             } while (sat == z3::check_result::sat);
 
+            if (this->get_incremental()){
+                this->pop_objective_scope();
+            }
+
         } else {
             throw std::runtime_error("Must not happen!");
         }
@@ -1539,32 +2053,8 @@ void MacroCircuit::dump_smt_instance()
     size_t sol = 1;
 
     do {
-        if (m_layout->is_free_ux()){
-            out_file << "(get-value (" << m_layout->get_ux() << "))" << std::endl;
-        }
-        if (m_layout->is_free_uy()){
-            out_file << "(get-value (" << m_layout->get_uy() << "))" << std::endl;
-        }
-        
-        for (Terminal* t: m_terminals){
-            //if (t->is_free()){
-                out_file << "(get-value (" << t->get_pos_x() << "))" << std::endl;
-                out_file << "(get-value (" << t->get_pos_y() << "))" << std::endl;
-            //}
-        }
-        for(Component* c: m_components){
-            if (c->is_free()){
-                out_file << "(get-value (" << c->get_lx() << "))" << std::endl;
-                out_file << "(get-value (" << c->get_ly() << "))" << std::endl;
-                out_file << "(get-value (" << c->get_orientation() << "))" << std::endl;
-            }
-            
-            for (Pin* p: c->get_pins()){
-                out_file << "(get-value (" << p->get_pin_pos_x() << "))" << std::endl;
-                out_file << "(get-value (" << p->get_pin_pos_y() << "))" << std::endl;
-            }
-        }
-    
+        out_file << m_variables->get_value_query() << std::endl;
+
         sol++;
         if (sol <= this->get_max_solutions()){
             out_file << "(check-sat)" << std::endl;
@@ -1579,6 +2069,10 @@ void MacroCircuit::dump_smt_instance()
  */
 void MacroCircuit::results_to_db()
 {
+    nullpointer_check (m_db);
+
+    // Rolled back if a row fails
+    Utils::Database::ResultsBatch batch(*m_db);
     for (size_t i = 0; i < m_solutions; ++i){
         for (Component* component: m_components){
             m_db->place_component(i, component);
@@ -1614,79 +2108,99 @@ void MacroCircuit::results_to_db()
         }
         m_db->insert_layout(i, lx, ly, ux, uy);
     }
-    m_db->export_as_csv("results.csv");
+    batch.commit();
 }
 
 /**
- * @brief Wirelenght Cost Function
+ * @brief Export the Obtained Results without the Database
  */
-void MacroCircuit::encode_hpwl_length()
+void MacroCircuit::export_results()
 {
-    z3::expr_vector clauses(m_z3_ctx);
-
-    for (Edge* edge: m_tree->get_edges()){
-        
-        if (edge->get_from() == edge->get_to()){
-            /* Edge Points to Itself */
-            continue;
-        }
-
-        nullpointer_check(edge);
+    Utils::ResultExporter exporter(m_components, m_terminals, m_layout, m_solutions);
 
-        Node* from = edge->get_from();
-        Node* to   = edge->get_to();
-        nullpointer_check(from);
-        nullpointer_check(to);
+    exporter.export_csv("results.csv");
+    exporter.export_columns("results.bin");
+}
 
-        z3::expr from_x = m_encode->get_value(0);
-        z3::expr from_y = m_encode->get_value(0);
+/**
+ * @brief Collect the Pin Coordinates of a Net
+ *
+ * @param net Net ID
+ * @param pin_x X Coordinates of the Pins
+ * @param pin_y Y Coordinates of the Pins
+ * @param pin_node Node ID of each Pin
+ */
+void MacroCircuit::get_net_pins(size_t const net,
+                                std::vector<z3::expr>& pin_x,
+                                std::vector<z3::expr>& pin_y,
+                                std::vector<size_t>& pin_node)
+{
+    Hypergraph& hypergraph = m_tree->get_hypergraph();
 
-        z3::expr to_x = m_encode->get_value(0);
-        z3::expr to_y = m_encode->get_value(0);
+    for (size_t i = hypergraph.get_net_begin(net); i < hypergraph.get_net_end(net); ++i){
+        Node* node = hypergraph.get_node(hypergraph.get_pin_node(i));
+        nullpointer_check(node);
 
-        if (from->is_terminal()){
-            Terminal* t = from->get_terminal();
+        if (node->is_terminal()){
+            Terminal* t = node->get_terminal();
             nullpointer_check(t);
-            from_x = t->get_pos_x();
-            from_y = t->get_pos_y();
-        } else if (from->has_macro()){
-            Macro* m = from->get_macro();
+
+            pin_x.push_back(t->get_pos_x());
+            pin_y.push_back(t->get_pos_y());
+        } else if (node->has_macro()){
+            Macro* m = node->get_macro();
             nullpointer_check(m);
-            Pin* p = m->get_pin(edge->get_from_pin());
+            Pin* p = m->get_pin(hypergraph.get_pin_name(i));
             nullpointer_check(p);
 
-            from_x = p->get_pin_pos_x();
-            from_y = p->get_pin_pos_y();
+            pin_x.push_back(p->get_pin_pos_x());
+            pin_y.push_back(p->get_pin_pos_y());
         } else {
             notimplemented_check();
         }
+        pin_node.push_back(hypergraph.get_pin_node(i));
+    }
+}
 
-        if (to->is_terminal()){
-            Terminal* t = to->get_terminal();
-            nullpointer_check(t);
+/**
+ * @brief Wirelenght Cost Function
+ */
+void MacroCircuit::encode_hpwl_length()
+{
+    m_hpwl_edges = z3::expr_vector(m_z3_ctx);
 
-            to_x = t->get_pos_x();
-            to_y = t->get_pos_y();
-        } else if (to->has_macro()){
-            Macro* m = to->get_macro();
-            nullpointer_check(m);
+    if (this->get_bbox_hpwl()){
+        this->encode_hpwl_bounding_box();
+        return;
+    }
 
-            Pin* p = m->get_pin(edge->get_to_pin());
-            nullpointer_check(p);
+    z3::expr_vector clauses(m_z3_ctx);
+    Hypergraph& hypergraph = m_tree->get_hypergraph();
 
-            to_x = p->get_pin_pos_x();
-            to_y = p->get_pin_pos_y();
-        } else {
-            notimplemented_check();
+    for (size_t net = 0; net < hypergraph.get_num_nets(); ++net){
+        if (hypergraph.get_net_degree(net) < 2){
+            continue;
         }
-        
-        z3::expr hpwl = this->manhattan_distance(from_x, from_y, to_x, to_y);
-        if (edge->get_weight() > 1){
-            z3::expr cost = m_encode->get_value(edge->get_weight());
-            z3::expr smt = hpwl * cost;
-            clauses.push_back(smt);
-        } else {
-            clauses.push_back(hpwl);
+
+        // Pin Coordinates of the Net, the first Pin drives the Net
+        std::vector<z3::expr> pin_x;
+        std::vector<z3::expr> pin_y;
+        std::vector<size_t> pin_node;
+        this->get_net_pins(net, pin_x, pin_y, pin_node);
+
+        // Affinity Nets of skipped Cells carry their Connection Count
+        size_t weight = hypergraph.get_net_weight(net);
+
+        for (size_t i = 1; i < pin_x.size(); ++i){
+            if (pin_node[i] == pin_node[0]){
+                /* Pin on the Driver itself */
+                continue;
+            }
+            z3::expr distance = this->manhattan_distance(pin_x[0], pin_y[0], pin_x[i], pin_y[i]);
+            if (weight > 1){
+                distance = distance * m_encode->get_value(weight);
+            }
+            clauses.push_back(distance);
         }
     }
 
@@ -1697,6 +2211,61 @@ void MacroCircuit::encode_hpwl_length()
     m_hpwl_cost_function = m_encode->mk_sum(clauses);
 }
 
+/**
+ * @brief Wirelength as Sum of Net Bounding Boxes
+ *
+ * Every net gets its own bounding box variables enclosing all of its
+ * pins. Minimizing the weighted sum of the half-perimeters pulls the
+ * boxes tight, the sum is handed to the solver as a single objective.
+ */
+void MacroCircuit::encode_hpwl_bounding_box()
+{
+    z3::expr_vector bounds(m_z3_ctx);
+    z3::expr_vector costs(m_z3_ctx);
+    Hypergraph& hypergraph = m_tree->get_hypergraph();
+
+    for (size_t net = 0; net < hypergraph.get_num_nets(); ++net){
+        if (hypergraph.get_net_degree(net) < 2){
+            continue;
+        }
+
+        std::vector<z3::expr> pin_x;
+        std::vector<z3::expr> pin_y;
+        std::vector<size_t> pin_node;
+        this->get_net_pins(net, pin_x, pin_y, pin_node);
+
+        std::string id = "net_" + std::to_string(net);
+        z3::expr lx = m_encode->get_constant(id + "_lx");
+        z3::expr ly = m_encode->get_constant(id + "_ly");
+        z3::expr ux = m_encode->get_constant(id + "_ux");
+        z3::expr uy = m_encode->get_constant(id + "_uy");
+
+        for (size_t i = 0; i < pin_x.size(); ++i){
+            bounds.push_back(m_encode->le(lx, pin_x[i]));
+            bounds.push_back(m_encode->ge(ux, pin_x[i]));
+            bounds.push_back(m_encode->le(ly, pin_y[i]));
+            bounds.push_back(m_encode->ge(uy, pin_y[i]));
+        }
+
+        z3::expr hpwl = (ux - lx) + (uy - ly);
+        size_t weight = hypergraph.get_net_weight(net);
+        if (weight > 1){
+            hpwl = hpwl * m_encode->get_value(weight);
+        }
+        costs.push_back(hpwl);
+    }
+
+    if (costs.empty()){
+        return;
+    }
+
+    m_z3_opt->add(z3::mk_and(bounds));
+    m_hpwl_cost_function = m_encode->mk_sum(costs);
+    m_hpwl_edges.push_back(m_hpwl_cost_function);
+
+    m_logger->encode_hpwl_bounding_box(costs.size());
+}
+
 /**
  * @brief Calculate the Manhattan Distance between 2 Points in 2D System
  * 
@@ -1756,9 +2325,24 @@ void MacroCircuit::create_statistics()
  */
 void MacroCircuit::process_results(z3::model const & m)
 {
-     if (this->get_minimize_die_mode()){
-        size_t ux =  m.eval(m_layout->get_ux()).get_numeral_uint();
-        size_t uy =  m.eval(m_layout->get_uy()).get_numeral_uint();
+    std::vector<size_t> values;
+    m_variables->evaluate(m, values);
+
+    this->process_values(values);
+}
+
+/**
+ * @brief Store the values of one solution
+ *
+ * @param values Value per slot of the variable table
+ */
+void MacroCircuit::process_values(std::vector<size_t> const & values)
+{
+    assertion_check (values.size() == m_variables->size());
+
+    if (m_variables->has_die()){
+        size_t ux = values[m_variables->get_die_ux()];
+        size_t uy = values[m_variables->get_die_uy()];
 
         double area_estimation = ux * uy;
         double white_space = 100 - ((m_estimated_area/area_estimation)*100.0);
@@ -1771,140 +2355,104 @@ void MacroCircuit::process_results(z3::model const & m)
     }
     m_solutions++;
 
-    for(Component* component: m_components){
-        std::string name = component->get_name();
-
-        size_t x = m.eval(component->get_lx()).get_numeral_int();
-        size_t y = m.eval(component->get_ly()).get_numeral_int();
-        eOrientation o = static_cast<eOrientation>(m.eval(component->get_orientation()).get_numeral_int());
-
-        component->add_solution_lx(x);
-        component->add_solution_ly(y);
-        component->add_solution_orientation(o);
+    for (VariableTable::ComponentSlots const & slots: m_variables->get_components()){
+        size_t x = values[slots.lx];
+        size_t y = values[slots.ly];
+        eOrientation o = static_cast<eOrientation>(values[slots.orientation]);
 
-        m_logger->place_macro(component->get_id(), x ,y, o);
+        slots.component->add_solution(x, y, o);
 
-        //if (this->get_minimize_hpwl_mode()){
-            std::vector<Pin*> pins = component->get_pins();
-
-            for (Pin* p: pins){
-                //if (p->is_free()){
-                    z3::expr x = p->get_pin_pos_x();
-                    z3::expr y = p->get_pin_pos_y();
-
-                    z3::expr x_val = m.eval(x);
-                    z3::expr y_val = m.eval(y);
-
-                    size_t x_pos = x_val.get_numeral_uint();
-                    size_t y_pos = y_val.get_numeral_uint();
-
-                    p->add_solution_pin_pos_x(x_pos);
-                    p->add_solution_pin_pos_y(y_pos);
-                //}
-            }
-        //}
+        m_logger->place_macro(slots.component->get_id(), x ,y, o);
     }
+    for (VariableTable::PinSlots const & slots: m_variables->get_pins()){
+        slots.pin->add_solution_pin_pos(values[slots.x], values[slots.y]);
+    }
+    for (VariableTable::TerminalSlots const & slots: m_variables->get_terminals()){
+        slots.terminal->add_solution_pos(values[slots.x], values[slots.y]);
 
-    for (Terminal* terminal: m_terminals){
-        z3::expr clause_x = terminal->get_pos_x();
-        z3::expr clause_y = terminal->get_pos_y();
-
-        if (this->get_free_terminals()){
-            size_t val_x = m.eval(clause_x).get_numeral_uint();
-            size_t val_y = m.eval(clause_y).get_numeral_uint();
-
-            terminal->add_solution_pos_x(val_x);
-            terminal->add_solution_pos_y(val_y);
-
-            m_logger->place_terminal(terminal->get_name(),
-                                     val_x,
-                                     val_y);
-        }
+        m_logger->place_terminal(slots.terminal->get_name(),
+                                 values[slots.x],
+                                 values[slots.y]);
     }
 }
 
 /**
- * @brief Invoke Z3 Frontend for Problem Solving
- * 
- * Z3's Frontend shows much fast solving times than directly
- * invoking the API for solving. 
- * 
- * TODO Figure out why the API seems to run slower
+ * @brief Solve the encoded problem in the in-process solver pool
+ *
+ * Every worker gets a translation of m_z3_opt into its own context, the
+ * first one deciding the problem delivers all further solutions.
  */
-void MacroCircuit::solve_z3_no_api()
+void MacroCircuit::solve_z3_pool()
 {
-    m_logger->z3_shell_mode();
-
-    this->dump_smt_instance();
-    boost::filesystem::current_path(this->get_smt_directory());
-    std::string smt_file = "top_" + this->get_design_name() + ".smt2";
-    std::string results_file = this->get_smt_directory() +  "/top_" 
-                                 + this->get_design_name() + "_results.txt";
-
-    std::vector<std::string> args;
-    args.push_back("-T:" + std::to_string(this->get_timeout())); // -T:sec 
-    args.push_back(smt_file);
-
-#if BUILD_Z3
-    Utils::Utils::system_execute(this->get_third_party_bin() + "z3", args, results_file, true);
-#else 
-    Utils::Utils::system_execute("z3", args, results_file, true);
-#endif
+    m_logger->z3_pool_mode();
 
-    std::map<std::string, std::vector<size_t>> key_value_results;
-    std::vector<std::string> z3_results;
-    std::string line;
-    std::ifstream results(results_file);
-    while(std::getline(results, line)){
-        z3_results.push_back(line);
+    if(this->get_store_smt()){
+        this->dump_smt_instance();
     }
-    results.close();
+    this->configure_solver_pool();
 
-    if (z3_results[0] == "sat"){
-        // Nothing to do
-    } else if (z3_results[0] == "unsat"){
-         m_logger->unsat_solution();
+    z3::check_result sat = m_solver_pool->solve(*m_z3_opt);
+
+    if (sat == z3::check_result::unsat){
+        m_logger->unsat_solution();
         exit(0);
-    } else if (z3_results[0] == "unknown"){
+    } else if (sat == z3::check_result::unknown && !m_solver_pool->has_model()){
         m_logger->unknown_solution();
         exit(0);
-    } else if (z3_results[0] == "timeout"){
-        m_logger->solver_timeout();
-        exit(0);
-    } else {
-        notimplemented_check();
     }
-    m_solutions = 1;
+    m_solutions = 0;
 
-    for (size_t i = 1; i < z3_results.size(); ++i){
-        std::string line = z3_results[i];
-        
-        if (line == "sat"){
-            m_solutions++;
-        } else if (line == "unsat"){
-            m_logger->unsat_solution();
-            break;
-        } else if (line == "unknown"){
-            m_logger->unknown_solution();
+    do {
+        z3::model m = m_solver_pool->get_model();
+        this->process_results(m);
+
+        if ((sat == z3::check_result::sat) && (m_solutions < this->get_max_solutions())){
+            m_logger->pareto_step();
+            sat = m_solver_pool->next();
+        } else {
             break;
         }
+    } while (sat == z3::check_result::sat);
+}
 
-        std::string opening = line.substr(0,2);
-        std::string closing = line.substr(line.size() -2, 2);
-
-        if (opening == "((" && closing == "))"){
-            std::string content = line.substr(2, line.size() - 2);
-            content = content.substr(0, content.size() - 2);
-            std::vector<std::string> token = Utils::Utils::tokenize(content, " ");
-            std::string key = token[0];
-            size_t val = std::stoi(token[1]);
-            
-            key_value_results[key].push_back(val);
+/**
+ * @brief Select the configurations used by the solver pool workers
+ *
+ * In portfolio mode the workers additionally race differently seeded
+ * assertion orders. All of them use the priority chosen by the user.
+ */
+void MacroCircuit::configure_solver_pool()
+{
+    std::string priority = this->get_pareto_optimizer() ? "pareto" : "lex";
+    std::vector<SolverConfiguration> configurations;
+
+    if (this->get_portfolio()){
+        configurations = {
+            SolverConfiguration("basic",        "basic",  "maxres", true,  priority, 0),
+            SolverConfiguration("symba",        "symba",  "maxres", true,  priority, 1),
+            SolverConfiguration("farkas",       "farkas", "maxres", true,  priority, 2),
+            SolverConfiguration("basic-s3",     "basic",  "maxres", true,  priority, 3),
+            SolverConfiguration("symba-s4",     "symba",  "maxres", true,  priority, 4),
+            SolverConfiguration("basic-wmax",   "basic",  "wmax",   false, priority, 5)
+        };
+        for (size_t seed = configurations.size(); seed < this->get_solver_workers(); ++seed){
+            configurations.push_back(SolverConfiguration("basic-s" + std::to_string(seed),
+                                                         "basic", "maxres", true, priority, seed));
         }
+    } else {
+        configurations = {
+            SolverConfiguration("basic",      "basic",  "maxres", true,  priority, 0),
+            SolverConfiguration("symba",      "symba",  "maxres", true,  priority, 0),
+            SolverConfiguration("farkas",     "farkas", "maxres", true,  priority, 0),
+            SolverConfiguration("basic-wmax", "basic",  "wmax",   false, priority, 0)
+        };
     }
+    size_t workers = std::min(this->get_solver_workers(), configurations.size());
+    assertion_check (workers > 0);
 
-    for (size_t i = 0; i < m_solutions; ++i){
-        this->process_key_value_results(key_value_results, i);
+    m_solver_pool->clear_configurations();
+    for (size_t i = 0; i < workers; ++i){
+        m_solver_pool->add_configuration(configurations[i]);
     }
 }
 
@@ -1926,144 +2474,71 @@ void MacroCircuit::solve_optimathsat_no_api()
 
     Utils::Utils::system_execute(this->get_third_party_bin() + "optimathsat", args, results_file, true);
 
-    std::map<std::string, std::vector<size_t>> key_value_results;
-    std::vector<std::string> z3_results;
-    std::string line;
     std::ifstream results(results_file);
-    while(std::getline(results, line)){
-        z3_results.push_back(line);
-    }
+    std::stringstream output;
+    output << results.rdbuf();
     results.close();
 
-    if (z3_results[0] == "sat"){
+    // Split into status words and balanced get-value responses
+    std::vector<std::string> items;
+    std::string item;
+    size_t depth = 0;
+    for (char c: output.str()){
+        if (depth == 0 && std::isspace(static_cast<unsigned char>(c))){
+            if (!item.empty()){
+                items.push_back(item);
+                item.clear();
+            }
+            continue;
+        }
+        item += c;
+
+        if (c == '('){
+            depth++;
+        } else if (c == ')' && depth > 0){
+            depth--;
+            if (depth == 0){
+                items.push_back(item);
+                item.clear();
+            }
+        }
+    }
+    if (!item.empty()){
+        items.push_back(item);
+    }
+
+    std::string status = items.empty() ? "" : items[0];
+    if (status == "sat"){
         // Nothing to do
-    } else if (z3_results[0] == "unsat"){
+    } else if (status == "unsat"){
          m_logger->unsat_solution();
         exit(0);
-    } else if (z3_results[0] == "unknown"){
+    } else if (status == "unknown"){
         m_logger->unknown_solution();
         exit(0);
-    } else if (z3_results[0] == "timeout"){
+    } else if (status == "timeout"){
         m_logger->solver_timeout();
         exit(0);
     } else {
         notimplemented_check();
     }
-    m_solutions = 1;
+    m_solutions = 0;
 
-    for (size_t i = 1; i < z3_results.size(); ++i){
-        std::string line = z3_results[i];
-        
-        if (line == "sat"){
-            m_solutions++;
-        } else if (line == "unsat"){
+    std::vector<size_t> values;
+    for (size_t i = 1; i < items.size(); ++i){
+        if (items[i] == "unsat"){
             m_logger->unsat_solution();
             break;
-        } else if (line == "unknown"){
+        } else if (items[i] == "unknown"){
             m_logger->unknown_solution();
             break;
         }
-        
-        if (line[0] == '(' && line[line.size()-1] == ')'){
-            // Drop out brackets first
-            line = line.substr(2, line.size()-1);
-            line = line.substr(0, line.size()-2);
-            
-            // Drop inner brackets
-            line = line.substr(1, line.size()-1);
-            line = line.substr(0, line.size()-1);
-            
-            std::vector<std::string> token = Utils::Utils::tokenize(line, " ");
-            std::string key = token[0];
-            size_t value = std::stoi(token[1]);
-            
-            key_value_results[key].push_back(value);
-        }
-    }
 
-    for (size_t i = 0; i < m_solutions; ++i){
-        this->process_key_value_results(key_value_results, i);
-    }
-}
-
-/**
- * @brief Process a generated result
- * 
- * @param solution Results
- * @param id ID to Process
- */
-void MacroCircuit::process_key_value_results(std::map<std::string, std::vector<size_t>> & solution, size_t const id)
-{
-    if (this->get_minimize_die_mode()){
-        assertion_check (solution.find(m_layout->get_ux().to_string()) != solution.end());
-        assertion_check (solution.find(m_layout->get_uy().to_string()) != solution.end());
-        size_t ux = solution[m_layout->get_ux().to_string()][id];
-        size_t uy = solution[m_layout->get_uy().to_string()][id];
-
-        double area_estimation = ux * uy;
-        double white_space = 100 - ((m_estimated_area/area_estimation)*100.0);
-
-        m_logger->result_die_area(area_estimation);
-        m_logger->white_space(white_space);
-
-        m_layout->set_solution_ux(ux);
-        m_layout->set_solution_uy(uy);
-        m_logger->add_solution_layout(ux, uy);
-    }
-    for (Terminal* terminal: m_terminals){
-        z3::expr clause_x = terminal->get_pos_x();
-        z3::expr clause_y = terminal->get_pos_y();
-
-        if (this->get_free_terminals()){
-            assertion_check (solution.find(clause_x.to_string()) != solution.end());
-            assertion_check (solution.find(clause_y.to_string()) != solution.end());
-            
-            size_t val_x = solution[clause_x.to_string()][id];
-            size_t val_y = solution[clause_y.to_string()][id];
-
-            terminal->add_solution_pos_x(val_x);
-            terminal->add_solution_pos_y(val_y);
-
-            m_logger->place_terminal(terminal->get_name(),
-                                     val_x,
-                                     val_y);
+        // Responses not matching the query, e.g. objectives, are skipped
+        if (items[i][0] == '(' && m_variables->parse_values(items[i], values)){
+            this->process_values(values);
         }
     }
-
-    for(Component* component: m_components){
-        if (this->get_minimize_die_mode()){
-            assertion_check (solution.find(component->get_lx().to_string()) != solution.end());
-            assertion_check (solution.find(component->get_ly().to_string()) != solution.end());
-            size_t x = solution[component->get_lx().to_string()][id];
-            size_t y = solution[component->get_ly().to_string()][id];
-            eOrientation o = static_cast<eOrientation>(solution[component->get_orientation().to_string()][id]);
-
-            component->add_solution_lx(x);
-            component->add_solution_ly(y);
-            component->add_solution_orientation(o);
-
-            m_logger->place_macro(component->get_id(), x ,y, o);
-        }
-        //if (this->get_minimize_hpwl_mode()){
-            std::vector<Pin*> pins = component->get_pins();
-
-            for (Pin* p: pins){
-                if (p->is_free()){
-                    z3::expr x = p->get_pin_pos_x();
-                    z3::expr y = p->get_pin_pos_y();
-
-                    assertion_check(solution.find(x.to_string()) != solution.end());
-                    assertion_check (solution.find(y.to_string()) != solution.end());
-                    
-                    size_t x_pos = solution[x.to_string()][id];
-                    size_t y_pos = solution[y.to_string()][id];
-
-                    p->add_solution_pin_pos_x(x_pos);
-                    p->add_solution_pin_pos_y(y_pos);
-                }
-            }
-        //}
-    }
 }
 
 /**
@@ -17,6 +17,7 @@
 #include <fstream>
 #include <cstdio>
 #include <map>
+#include <set>
 #include <unordered_map>
 #include <thread>
 #include <chrono>
@@ -28,9 +29,11 @@
 #include <boost/filesystem.hpp>
 
 #include <object.hpp>
+#include <placement_context.hpp>
 #include <components.hpp>
 #include <lefdefIO.h>
 #include <tree.hpp>
+#include <symbol_table.hpp>
 #include <evaluate.hpp>
 #include <logger.hpp>
 #include <timer.hpp>
@@ -43,8 +46,13 @@
 #include <utils.hpp>
 #include <def_utils.hpp>
 #include <database.hpp>
+#include <result_exporter.hpp>
 #include <plotter.hpp>
 #include <hlclient.hpp>
+#include <solver_pool.hpp>
+#include <variable_table.hpp>
+#include <design_snapshot.hpp>
+#include <lef_library.hpp>
 
 namespace Placer {
 
@@ -75,6 +83,7 @@ public:
     void save_best();
 
     void results_to_db();
+    void export_results();
 
     void create_statistics();
 
@@ -87,10 +96,12 @@ private:
     z3::optimize* m_z3_opt;
 
     Circuit::Circuit* m_circuit;
+    Circuit::DefDatabase* m_def_database;
+    std::vector<LefLibrary*> m_libraries;
     std::vector<Macro*> m_macros;
-    std::vector<MacroDefinition> m_macro_definitions;
 
     std::vector<Cell*> m_cells;
+    std::vector<CellDefinition> m_cell_definitions;
 
     std::vector<Terminal*> m_terminals;
 
@@ -110,10 +121,11 @@ private:
     EncodingUtils* m_encode;
     Plotter* m_plotter;
     HLClient* m_hl_client;
+    SolverPool* m_solver_pool;
+    VariableTable* m_variables;
+    DesignSnapshot* m_snapshot;
 
-    std::map<std::string, Macro*> m_id2macro;
-    std::map<std::string, Terminal*> m_id2terminal;
-    std::map<std::string, Cell*> m_id2cell;
+    SymbolTable* m_symbols;
     size_t m_solutions;
     size_t m_estimated_area;
 
@@ -123,9 +135,12 @@ private:
 
     void build_circuit_lefdef();
     void build_circuit_bookshelf();
+    void read_libraries();
+    void parse_def();
+    void parse_lefdef();
+    std::string get_input_path(std::string const & file);
 
-    bool is_macro(LefDefParser::defiComponent const & macro);
-    bool is_standard_cell(LefDefParser::defiComponent const & cell);
+    std::pair<LefLibrary*, size_t> find_lef_macro(std::string const & name);
 
     /**
      * Thread Functions
@@ -135,12 +150,13 @@ private:
     void add_cells();
     void area_estimator();
 
-    void add_cell(LefDefParser::defiComponent const & cmp);
+    void add_cell(DesignSnapshot::CellRecord const & cell);
 
     void build_tree_from_lefdef();
+    void build_tree_skip_cells();
     void init_tree(eInputFormat const type);
 
-    void create_macro_definitions();
+    void create_snapshot();
 
     void write_def(std::string const & name, size_t const solution);
     void write_lef(std::string const & name);
@@ -157,13 +173,27 @@ private:
 
     void config_z3();
     void run_encoding();
+    void encode_base_constraints();
+    void encode_objectives();
+
+    bool m_objective_scope;
+    void push_objective_scope();
+    void pop_objective_scope();
+    z3::expr block_solution(z3::model const & m);
 
     void encode_components_inside_die(eRotation const type);
     void encode_components_non_overlapping(eRotation const type);
+    void encode_components_non_overlapping_symmetric(eRotation const type);
+    std::set<std::pair<size_t, size_t>> find_overlapping_fixed_components();
     void encode_terminals_on_frontier();
     void encode_terminals_non_overlapping();
     void encode_terminals_center_edge();
     void encode_hpwl_length();
+    void encode_hpwl_bounding_box();
+    void get_net_pins(size_t const net,
+                      std::vector<z3::expr>& pin_x,
+                      std::vector<z3::expr>& pin_y,
+                      std::vector<size_t>& pin_node);
     void encode_layout_on_grid();
     void encode_components_on_grid();
     void encode_terminals_on_grid();
@@ -188,11 +218,13 @@ private:
      * SMT Solving
      */ 
     void solve_z3_api();
-    void solve_z3_no_api();
+    void solve_z3_pool();
+    void configure_solver_pool();
     void solve_optimathsat_no_api();
+    void build_variable_table();
     void process_results(z3::model const & m);
+    void process_values(std::vector<size_t> const & values);
     void dump_smt_instance();
-    void process_key_value_results(std::map<std::string, std::vector<size_t>> & solution, size_t const id);
 
 };
 
@@ -131,25 +131,26 @@ void ParquetFrontend::build_db()
         m_nodes->putNewTerm(next_term);
     }
     
-    std::vector<Edge*> edges = m_tree->get_edges();
-    
-    for(size_t i = 0; i < edges.size(); ++i){
-        Edge* edge = edges[i];
-        
-        Node* from = edge->get_from();
-        Node* to   = edge->get_to();
+    Hypergraph& hypergraph = m_tree->get_hypergraph();
+    size_t net_idx = 0;
 
-        parquetfp::Net tmpEdge;
-        parquetfp::pin tempPin1(from->get_id().c_str(), true, 0, 0, i);
-        parquetfp::pin tempPin2(to->get_id().c_str(), true, 0, 0, i );
+    for(size_t net = 0; net < hypergraph.get_num_nets(); ++net){
+        if (hypergraph.get_net_degree(net) < 2){
+            continue;
+        }
 
-        tmpEdge.addNode(tempPin1);
-        tmpEdge.addNode(tempPin2);
-        tmpEdge.putIndex(i);
-        tmpEdge.putName(std::string("n"+std::to_string(i)).c_str());
+        parquetfp::Net tmpEdge;
+        for (size_t i = hypergraph.get_net_begin(net); i < hypergraph.get_net_end(net); ++i){
+            Node* node = hypergraph.get_node(hypergraph.get_pin_node(i));
+            parquetfp::pin tempPin(node->get_id().c_str(), true, 0, 0, net_idx);
+            tmpEdge.addNode(tempPin);
+        }
+        tmpEdge.putIndex(net_idx);
+        tmpEdge.putName(std::string("n"+std::to_string(net_idx)).c_str());
         tmpEdge.putWeight(1);
 
         m_nets->putNewNet(tmpEdge);
+        net_idx++;
     }
 
     m_nets->updateNodeInfo(*m_nodes);
@@ -237,9 +238,7 @@ void ParquetFrontend::data_from_parquet()
             notimplemented_check();
        }
 
-       m->add_solution_orientation(orient_solution);
-       m->add_solution_lx(x);
-       m->add_solution_ly(y);
+       m->add_solution(x, y, orient_solution);
     }
 
     m_layout->set_solution_ux(m_db->getXMax());
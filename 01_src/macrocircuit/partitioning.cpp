@@ -25,7 +25,11 @@ Partitioning::Partitioning():
     m_hpwl_cost_function(m_encode->get_value(0))
 {
     m_kmeans = new KMeans();
+    m_floorplan_cache = new FloorplanCache();
     m_logger = Logger::getInstance();
+
+    // Rotation Freedom and Objectives of Partitioning::encode
+    m_encoding_key = "e2D:lex(ux,uy)";
 }
 
 /**
@@ -35,6 +39,10 @@ Partitioning::~Partitioning()
 {
     delete m_encode; m_encode = nullptr;
     delete m_kmeans; m_kmeans = nullptr;
+    delete m_floorplan_cache; m_floorplan_cache = nullptr;
+    for (Partition* itor: m_hierarchy){
+        delete itor; itor = nullptr;
+    }
     m_tree = nullptr;
     m_logger = nullptr;
 }
@@ -45,7 +53,11 @@ Partitioning::~Partitioning()
 void Partitioning::run()
 {
     //this->kmeans_clustering();
-    this->hypergraph_partitioning();
+    if (this->get_hierarchical()){
+        this->hierarchical_partitioning();
+    } else {
+        this->hypergraph_partitioning();
+    }
 }
 
 /**
@@ -82,6 +94,7 @@ void Partitioning::create_initial_partitions()
     }
     std::cout << "Sorted: " << sorted.size() << std::endl;
     
+    std::vector<Partition*> partitions;
     for (auto itor: sorted){
         for (size_t j = 0; j < itor.second.size(); j+= this->get_partition_size()){
             Partition* next_partition = new Partition();
@@ -90,19 +103,12 @@ void Partitioning::create_initial_partitions()
                 next_partition->add_macro(itor.second[k]);
             }
             m_components.push_back(next_partition);
-            m_z3_opt = new z3::optimize(m_z3_ctx);
-            this->encode(next_partition);
-            this->solve(next_partition);
-            size_t w = next_partition->get_ux().get_numeral_uint();
-            size_t h = next_partition->get_uy().get_numeral_uint();
-            delete m_z3_opt; m_z3_opt = nullptr;
-
-            next_partition->set_height(h);
-            next_partition->set_witdh(w);
-            next_partition->free_lx();
-            next_partition->free_ly();
+            partitions.push_back(next_partition);
         }
     }
+
+    this->solve_partitions(partitions);
+
     std::cout << "Partitions: " << m_components.size() << std::endl;
 }
 
@@ -483,25 +489,159 @@ void Partitioning::solve(Partition* next_partition)
 
     if(sat == z3::check_result::sat){
         z3::model m = m_z3_opt->get_model();
+        this->process_results(next_partition, m);
+    }
+}
 
-        size_t ux = m.eval(next_partition->get_ux()).get_numeral_uint();
-        size_t uy = m.eval(next_partition->get_uy()).get_numeral_uint();
-        next_partition->set_ux(ux);
-        next_partition->set_uy(uy);
-           
-        for(auto itor: next_partition->get_components()){
-            size_t x = m.eval(itor->get_lx()).get_numeral_uint();
-            size_t y = m.eval(itor->get_ly()).get_numeral_uint();
-            eOrientation o = static_cast<eOrientation>(m.eval(itor->get_orientation()).get_numeral_uint());
-
-            itor->add_solution_lx(x);
-            itor->add_solution_ly(y);
-            itor->add_solution_orientation(o);
+/**
+ * @brief Solve independent Partitions and fix their Shape
+ *
+ * Partitions found in the floorplan cache are not encoded at all, the
+ * remaining ones are encoded serially in the shared context and solved in
+ * parallel afterwards.
+ *
+ * @param partitions Partitions to Solve
+ */
+void Partitioning::solve_partitions(std::vector<Partition*> & partitions)
+{
+    std::vector<Partition*> pending;
+    std::vector<z3::optimize*> problems;
+    for (Partition* next_partition: partitions){
+        if (m_floorplan_cache->is_enabled() &&
+            m_floorplan_cache->lookup(next_partition, m_encoding_key)){
+            continue;
         }
-        //next_partition->get_white_space_percentage();
+        m_z3_opt = new z3::optimize(m_z3_ctx);
+        this->encode(next_partition);
+
+        pending.push_back(next_partition);
+        problems.push_back(m_z3_opt);
+        m_z3_opt = nullptr;
+    }
+
+    if (m_floorplan_cache->is_enabled()){
+        m_logger->floorplan_cache(partitions.size() - pending.size(), pending.size());
+    }
+    if (!pending.empty()){
+        this->solve_parallel(pending, problems);
+    }
+
+    for (z3::optimize* itor: problems){
+        delete itor; itor = nullptr;
+    }
+
+    for (Partition* next_partition: partitions){
+        size_t w = next_partition->get_ux().get_numeral_uint();
+        size_t h = next_partition->get_uy().get_numeral_uint();
+
+        next_partition->set_height(h);
+        next_partition->set_witdh(w);
+        next_partition->free_lx();
+        next_partition->free_ly();
     }
 }
 
+/**
+ * @brief Solve independent Partitions concurrently
+ *
+ * Every problem is translated into a context of its own, the worker threads
+ * never touch the shared context. Results are merged back on the calling
+ * thread.
+ *
+ * @param partitions Partitions to Solve
+ * @param problems Encoded problem per Partition
+ */
+void Partitioning::solve_parallel(std::vector<Partition*> & partitions,
+                                  std::vector<z3::optimize*> & problems)
+{
+    assertion_check (partitions.size() == problems.size());
+
+    try {
+        size_t workers = std::max<size_t>(1, std::thread::hardware_concurrency());
+        workers = std::min(workers, partitions.size());
+        m_logger->solve_partitions(partitions.size(), workers);
+
+        // Optimizers are released before their contexts on every exit
+        std::vector<std::unique_ptr<z3::context>> contexts;
+        std::vector<std::unique_ptr<z3::optimize>> translated;
+        std::vector<z3::check_result> results(problems.size(), z3::check_result::unknown);
+
+        for (z3::optimize* problem: problems){
+            contexts.emplace_back(new z3::context());
+            z3::context* ctx = contexts.back().get();
+            translated.emplace_back(new z3::optimize(*ctx, *problem));
+            z3::optimize* opt = translated.back().get();
+
+            z3::params param(*ctx);
+            param.set("priority", ctx->str_symbol("lex"));
+            if (this->get_timeout() != 0){
+                param.set("timeout", (unsigned)this->get_timeout() * 1000);
+            }
+            opt->set(param);
+        }
+
+        std::atomic<size_t> next(0);
+        auto worker = [&](){
+            for (size_t i = next++; i < translated.size(); i = next++){
+                try {
+                    results[i] = translated[i]->check();
+                } catch (z3::exception const & exp){
+                    results[i] = z3::check_result::unknown;
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < workers; ++i){
+            threads.push_back(std::thread(worker));
+        }
+        for (std::thread& itor: threads){
+            itor.join();
+        }
+
+        for (size_t i = 0; i < partitions.size(); ++i){
+            if (results[i] == z3::check_result::sat){
+                z3::model m = translated[i]->get_model();
+                z3::model result(m, m_z3_ctx, z3::model::translate());
+                this->process_results(partitions[i], result);
+
+                if (m_floorplan_cache->is_enabled()){
+                    m_floorplan_cache->store(partitions[i], m_encoding_key, result);
+                }
+            } else {
+                throw PlacerException("Partition " + std::to_string(partitions[i]->get_key()) + " could not be solved!");
+            }
+        }
+    } catch (z3::exception const & exp){
+        throw PlacerException(exp.msg());
+    }
+}
+
+/**
+ * @brief Store the Solution of a Partition
+ *
+ * @param next_partition Solved Partition
+ * @param m Model in the shared context
+ */
+void Partitioning::process_results(Partition* next_partition, z3::model const & m)
+{
+    nullpointer_check (next_partition);
+
+    size_t ux = m.eval(next_partition->get_ux()).get_numeral_uint();
+    size_t uy = m.eval(next_partition->get_uy()).get_numeral_uint();
+    next_partition->set_ux(ux);
+    next_partition->set_uy(uy);
+
+    for(auto itor: next_partition->get_components()){
+        size_t x = m.eval(itor->get_lx()).get_numeral_uint();
+        size_t y = m.eval(itor->get_ly()).get_numeral_uint();
+        eOrientation o = static_cast<eOrientation>(m.eval(itor->get_orientation()).get_numeral_uint());
+
+        itor->add_solution(x, y, o);
+    }
+    //next_partition->get_white_space_percentage();
+}
+
 /**
  * @brief Encode HPWL as Cost Function for Optimizer
  * 
@@ -601,67 +741,31 @@ void Partitioning::api_based_partitioning()
         key_to_macro[m->get_key()] = m;
     }
 
-    size_t hyperedge_idx = 0;
-    size_t hyperedge_idx_idx = 0;
-
-    Tree tmp_tree(*m_tree);
-    tmp_tree.strip_terminals();
-    
-    std::map<std::string, std::set<std::string>> steiner_tree = tmp_tree.get_steiner_tree();
-
-    // Resolve Number of Total Needed Array Spaces for Hyperedge Container
-    std::vector<std::set<std::string>> key_tree;
-    for (auto itor: steiner_tree){
-        std::set<std::string> tmp;
-        std::vector<std::string> token = Utils::Utils::tokenize(itor.first, ":");
-        tmp.insert(token[0]);
-        for (auto itor2: itor.second){
-            std::vector<std::string> token2 = Utils::Utils::tokenize(itor2, ":");
-            tmp.insert(token2[0]);
-        }
-        key_tree.push_back(tmp);
-    }
-    size_t hyperedge_cnt =0;
-    for (auto itor: key_tree){
-        hyperedge_cnt += itor.size();
-    }
-
-    kahypar_hypernode_id_t num_vertices =  m_macros.size() + m_terminals.size();
-    kahypar_hyperedge_id_t num_hyperedges = steiner_tree.size();
-
-    std::unique_ptr<kahypar_hyperedge_id_t[]> hyperedges = std::make_unique<kahypar_hyperedge_id_t[]>(hyperedge_cnt);
-    std::unique_ptr<size_t[]> hyperedge_indices = std::make_unique<size_t[]>(num_hyperedges+1);
-
-     for (auto edge: steiner_tree){
-        std::vector<std::string> root_token = Utils::Utils::tokenize(edge.first, ":");
-        Macro* root = this->find_macro(root_token[0]);
-        nullpointer_check(root);
-        size_t root_key = root->get_key();
-        hyperedges[hyperedge_idx] = root_key;
-        hyperedge_indices[hyperedge_idx_idx] = hyperedge_idx;
+    Hypergraph& hypergraph = m_tree->get_hypergraph();
 
-        hyperedge_idx++;
-        hyperedge_idx_idx++;
-
-        std::set<size_t> sub_keys;
-        for (auto itor2: edge.second){
-            std::vector<std::string> token = Utils::Utils::tokenize(itor2, ":");
-            Macro* m = this->find_macro(token[0]);
-            nullpointer_check(m);
-            size_t sub_key = m->get_key();
+    // Macro Keys of every Net, Terminals are not partitioned
+    std::vector<kahypar_hyperedge_id_t> hyperedges;
+    std::vector<size_t> hyperedge_indices;
+    for (size_t net = 0; net < hypergraph.get_num_nets(); ++net){
+        std::vector<kahypar_hyperedge_id_t> keys;
+        for (size_t i = hypergraph.get_net_begin(net); i < hypergraph.get_net_end(net); ++i){
+            Node* node = hypergraph.get_node(hypergraph.get_pin_node(i));
+            nullpointer_check(node);
 
             // No Edge can point at itself
-            // Use a set to get unique subkeys
-            sub_keys.insert(sub_key);
-        }
-        for (auto itor2: sub_keys){
-            if (itor2 != root_key){
-                hyperedges[hyperedge_idx] = itor2;
-                hyperedge_idx++;
+            if (node->has_macro() && std::find(keys.begin(), keys.end(), node->get_key()) == keys.end()){
+                keys.push_back(node->get_key());
             }
         }
+        if (keys.size() > 1){
+            hyperedge_indices.push_back(hyperedges.size());
+            hyperedges.insert(hyperedges.end(), keys.begin(), keys.end());
+        }
     }
-    hyperedge_indices[hyperedge_idx_idx] = hyperedge_idx;
+    hyperedge_indices.push_back(hyperedges.size());
+
+    kahypar_hypernode_id_t num_vertices =  m_macros.size() + m_terminals.size();
+    kahypar_hyperedge_id_t num_hyperedges = hyperedge_indices.size() - 1;
 
     double imbalance = 0.03;
     kahypar_partition_id_t k = this->get_num_partitions();
@@ -679,8 +783,8 @@ void Partitioning::api_based_partitioning()
                       k,
                       w1,
                       w2,
-                      hyperedge_indices.get(),
-                      hyperedges.get(),
+                      hyperedge_indices.data(),
+                      hyperedges.data(),
                       &objective,
                       context,
                       partition.data());
@@ -724,6 +828,282 @@ void Partitioning::api_based_partitioning()
 #endif
 }
 
+/**
+ * @brief Recursive Partition and Place
+ *
+ * The netlist is bisected until the requested number of top level
+ * partitions exists, every top level partition is bisected further until
+ * its leaves hold at most leaf-size macros. Leaves are solved first, every
+ * parent is solved afterwards with its solved children as rectangular
+ * blocks. The top level partitions are handed to the global instance.
+ */
+void Partitioning::hierarchical_partitioning()
+{
+    this->build_hyperedges();
+
+    std::vector<std::vector<Macro*>> groups;
+    if (!m_macros.empty()){
+        groups.push_back(m_macros);
+    }
+
+    while (groups.size() < this->get_num_partitions()){
+        auto largest = std::max_element(groups.begin(), groups.end(),
+            [](std::vector<Macro*> const & a, std::vector<Macro*> const & b){
+                return a.size() < b.size();
+            });
+        if (largest == groups.end() || largest->size() < 2){
+            break;
+        }
+        std::pair<std::vector<Macro*>, std::vector<Macro*>> halves = this->bisect(*largest);
+        *largest = halves.first;
+        groups.push_back(halves.second);
+    }
+
+    std::map<size_t, std::vector<Partition*>> levels;
+    std::vector<Partition*> top;
+    for (std::vector<Macro*> const & group: groups){
+        size_t level = 0;
+        top.push_back(this->build_hierarchy(group, levels, level));
+    }
+
+    size_t partitions = 0;
+    for (auto itor: levels){
+        partitions += itor.second.size();
+    }
+    m_logger->build_hierarchy(partitions, levels.size());
+
+    this->solve_hierarchy(levels);
+
+    for (size_t i = 0; i < top.size(); ++i){
+        Partition* next_partition = top[i];
+        for (Macro* m: groups[i]){
+            m->set_parent_partition(next_partition);
+        }
+        next_partition->push_up_pins();
+        next_partition->encode_partition();
+        m_components.push_back(next_partition);
+
+        m_hierarchy.erase(std::remove(m_hierarchy.begin(), m_hierarchy.end(), next_partition),
+                          m_hierarchy.end());
+    }
+}
+
+/**
+ * @brief Collect the Macro Hyperedges of the Netlist
+ */
+void Partitioning::build_hyperedges()
+{
+    nullpointer_check (m_tree);
+
+    Hypergraph& hypergraph = m_tree->get_hypergraph();
+
+    m_hyperedges.clear();
+    for (size_t net = 0; net < hypergraph.get_num_nets(); ++net){
+        std::vector<Macro*> pins;
+        for (size_t i = hypergraph.get_net_begin(net); i < hypergraph.get_net_end(net); ++i){
+            Node* node = hypergraph.get_node(hypergraph.get_pin_node(i));
+            nullpointer_check(node);
+
+            if (node->has_macro() && std::find(pins.begin(), pins.end(), node->get_macro()) == pins.end()){
+                pins.push_back(node->get_macro());
+            }
+        }
+        if (pins.size() > 1){
+            m_hyperedges.push_back(pins);
+        }
+    }
+}
+
+/**
+ * @brief Split a Set of Macros into two connected Halves
+ *
+ * Uses Kahypar if available, otherwise the halves are grown greedily along
+ * the strongest connections until half of the macro area is covered.
+ *
+ * @param macros Macros to Split
+ * @return std::pair< std::vector< Placer::Macro* >, std::vector< Placer::Macro* > >
+ */
+std::pair<std::vector<Macro*>, std::vector<Macro*>> Partitioning::bisect(std::vector<Macro*> const & macros)
+{
+    assertion_check (macros.size() > 1);
+
+    std::map<Macro*, size_t> index;
+    for (size_t i = 0; i < macros.size(); ++i){
+        index[macros[i]] = i;
+    }
+
+    // Hyperedges restricted to the given macros, local indices
+    std::vector<std::vector<size_t>> hyperedges;
+    for (std::vector<Macro*> const & edge: m_hyperedges){
+        std::vector<size_t> local;
+        for (Macro* m: edge){
+            auto find = index.find(m);
+            if (find != index.end()){
+                local.push_back(find->second);
+            }
+        }
+        if (local.size() > 1){
+            hyperedges.push_back(local);
+        }
+    }
+
+    std::vector<bool> side(macros.size(), false);
+
+#ifdef ENABLE_KAHYPAR
+    if (!hyperedges.empty()){
+        std::ofstream out(this->get_active_results_directory() + "/kahypar.txt", std::ios::app);
+        std::streambuf *coutbuf = std::cout.rdbuf();
+        std::cout.rdbuf(out.rdbuf());
+
+        kahypar_context_t* context = kahypar_context_new();
+        std::string config_file = this->get_base_path() + "/04_configuration/kahypar.ini";
+        kahypar_configure_context_from_file(context, config_file.c_str());
+
+        std::vector<kahypar_hyperedge_id_t> pins;
+        std::vector<size_t> indices;
+        for (std::vector<size_t> const & edge: hyperedges){
+            indices.push_back(pins.size());
+            pins.insert(pins.end(), edge.begin(), edge.end());
+        }
+        indices.push_back(pins.size());
+
+        kahypar_hyperedge_weight_t objective = 0;
+        std::vector<kahypar_partition_id_t> partition(macros.size());
+
+        kahypar_partition(macros.size(),
+                          hyperedges.size(),
+                          0.03,
+                          2,
+                          nullptr,
+                          nullptr,
+                          indices.data(),
+                          pins.data(),
+                          &objective,
+                          context,
+                          partition.data());
+
+        kahypar_context_free(context);
+        std::cout.rdbuf(coutbuf);
+
+        for (size_t i = 0; i < macros.size(); ++i){
+            side[i] = (partition[i] == 1);
+        }
+    }
+#else
+    std::vector<std::map<size_t, size_t>> connectivity(macros.size());
+    for (std::vector<size_t> const & edge: hyperedges){
+        for (size_t a: edge){
+            for (size_t b: edge){
+                if (a != b){
+                    connectivity[a][b]++;
+                }
+            }
+        }
+    }
+
+    size_t total_area = 0;
+    size_t seed = 0;
+    for (size_t i = 0; i < macros.size(); ++i){
+        total_area += macros[i]->get_area();
+        if (macros[i]->get_area() > macros[seed]->get_area()){
+            seed = i;
+        }
+    }
+
+    std::vector<size_t> gain(macros.size(), 0);
+    size_t grown_area = macros[seed]->get_area();
+    size_t grown = 1;
+    size_t last = seed;
+    side[seed] = true;
+
+    while ((2 * grown_area < total_area) && (grown + 1 < macros.size())){
+        for (auto itor: connectivity[last]){
+            gain[itor.first] += itor.second;
+        }
+
+        size_t best = macros.size();
+        for (size_t i = 0; i < macros.size(); ++i){
+            if (!side[i] && ((best == macros.size()) || (gain[i] > gain[best]))){
+                best = i;
+            }
+        }
+
+        side[best] = true;
+        grown_area += macros[best]->get_area();
+        grown++;
+        last = best;
+    }
+#endif
+
+    std::pair<std::vector<Macro*>, std::vector<Macro*>> halves;
+    for (size_t i = 0; i < macros.size(); ++i){
+        if (side[i]){
+            halves.second.push_back(macros[i]);
+        } else {
+            halves.first.push_back(macros[i]);
+        }
+    }
+
+    // Degenerated Split, fall back to Halves in Input Order
+    if (halves.first.empty() || halves.second.empty()){
+        size_t middle = macros.size() / 2;
+        halves.first.assign(macros.begin(), macros.begin() + middle);
+        halves.second.assign(macros.begin() + middle, macros.end());
+    }
+
+    return halves;
+}
+
+/**
+ * @brief Recursively bisect Macros into a Tree of Partitions
+ *
+ * @param macros Macros of the current Subtree
+ * @param levels Partitions sorted by their Height in the Tree
+ * @param level Height of the returned Partition, Leaves are Level 0
+ * @return Placer::Partition*
+ */
+Partition* Partitioning::build_hierarchy(std::vector<Macro*> const & macros,
+                                         std::map<size_t, std::vector<Partition*>> & levels,
+                                         size_t & level)
+{
+    assertion_check (!macros.empty());
+
+    Partition* next_partition = new Partition();
+    m_hierarchy.push_back(next_partition);
+
+    if (macros.size() <= this->get_leaf_size()){
+        next_partition->add_macros(macros);
+        level = 0;
+    } else {
+        std::pair<std::vector<Macro*>, std::vector<Macro*>> halves = this->bisect(macros);
+
+        size_t level_a = 0;
+        size_t level_b = 0;
+        next_partition->add_subpartition(this->build_hierarchy(halves.first, levels, level_a));
+        next_partition->add_subpartition(this->build_hierarchy(halves.second, levels, level_b));
+        level = std::max(level_a, level_b) + 1;
+    }
+    levels[level].push_back(next_partition);
+
+    return next_partition;
+}
+
+/**
+ * @brief Solve the Partition Tree bottom-up
+ *
+ * All Partitions of one level are independent and solved in parallel,
+ * afterwards their shape is fixed for the next level.
+ *
+ * @param levels Partitions sorted by their Height in the Tree
+ */
+void Partitioning::solve_hierarchy(std::map<size_t, std::vector<Partition*>> & levels)
+{
+    for (auto& itor: levels){
+        m_logger->solve_hierarchy_level(itor.first, itor.second.size());
+        this->solve_partitions(itor.second);
+    }
+}
+
 /**
  * @brief Perform Kahypar Partitioning based on an external Hypergraph File
  */
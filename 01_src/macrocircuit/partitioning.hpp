@@ -19,6 +19,12 @@
 #endif
 #include <cmath>
 #include <memory>
+#include <thread>
+#include <atomic>
+#include <map>
+#include <set>
+#include <algorithm>
+#include <fstream>
 
 #include <object.hpp>
 #include <partition.hpp>
@@ -29,6 +35,7 @@
 #include <kmeans.hpp>
 #include <exception.hpp>
 #include <tree.hpp>
+#include <floorplan_cache.hpp>
 
 namespace Placer {
 
@@ -53,18 +60,23 @@ public:
 
     void kmeans_clustering();
 
+    void hierarchical_partitioning();
+
     std::vector<Component*> get_partitions();
 
 private:
     z3::optimize* m_z3_opt;
     EncodingUtils* m_encode;
     KMeans* m_kmeans;
+    FloorplanCache* m_floorplan_cache;
     Tree* m_tree;
     Utils::Logger* m_logger;
 
     std::vector<Component*> m_components;
     std::vector<Macro*> m_macros;
     std::vector<Terminal*> m_terminals;
+    std::vector<Partition*> m_hierarchy;
+    std::vector<std::vector<Macro*>> m_hyperedges;
 
     void create_initial_partitions();
     Macro* find_macro(std::string const & id);
@@ -84,11 +96,16 @@ private:
     z3::expr m_components_in_partition;
     z3::expr m_components_non_overlapping;
     z3::expr m_hpwl_cost_function;
+    std::string m_encoding_key;
 
     /**
      * SMT Solver
      */
     void solve(Partition* next_partition);
+    void solve_partitions(std::vector<Partition*> & partitions);
+    void solve_parallel(std::vector<Partition*> & partitions,
+                        std::vector<z3::optimize*> & problems);
+    void process_results(Partition* next_partition, z3::model const & m);
     std::pair<size_t, size_t> find_shape(size_t const area);
     
     /**
@@ -96,6 +113,16 @@ private:
      */
     void file_based_partitioning();
     void api_based_partitioning();
+
+    /**
+     * Hierarchical Partition and Place
+     */
+    void build_hyperedges();
+    std::pair<std::vector<Macro*>, std::vector<Macro*>> bisect(std::vector<Macro*> const & macros);
+    Partition* build_hierarchy(std::vector<Macro*> const & macros,
+                               std::map<size_t, std::vector<Partition*>> & levels,
+                               size_t & level);
+    void solve_hierarchy(std::map<size_t, std::vector<Partition*>> & levels);
 };
 
 } /* namespace Placer */
@@ -66,15 +66,15 @@ void Plotter::run()
 
     matplotlibcpp::figure_size(800, 600);
 
-    size_t die_lx = m_layout->get_lx().get_numeral_uint();
-    size_t die_ly = m_layout->get_ly().get_numeral_uint();
+    size_t die_lx = m_layout->get_lx_numerical();
+    size_t die_ly = m_layout->get_ly_numerical();
 
     if(m_layout->is_free_ux()){
         matplotlibcpp::xlim(die_lx-0.5, m_layout->get_solution_ux(m_solution_id)+0.5);
         matplotlibcpp::ylim(die_ly-0.5, m_layout->get_solution_uy(m_solution_id)+0.5);
     } else {
-        size_t ux = m_layout->get_ux().get_numeral_uint();
-        size_t uy = m_layout->get_uy().get_numeral_uint();
+        size_t ux = m_layout->get_ux_numercial();
+        size_t uy = m_layout->get_uy_numerical();
         matplotlibcpp::xlim(die_lx-0.5, ux+0.5);
         matplotlibcpp::ylim(die_ly-0.5, uy+0.5);
     }
@@ -90,8 +90,8 @@ void Plotter::run()
         Component* cmp = m_components[j];
         nullpointer_check(cmp);
 
-        size_t width = cmp->get_width().get_numeral_uint();
-        size_t height = cmp->get_height().get_numeral_uint();
+        size_t width = cmp->get_width_numeral();
+        size_t height = cmp->get_height_numeral();
 
         size_t o = 0;
         size_t lx = 0;
@@ -102,7 +102,7 @@ void Plotter::run()
             lx = cmp->get_solution_lx(m_solution_id);
             ly = cmp->get_solution_ly(m_solution_id);
         } else {
-            o  = cmp->get_orientation().get_numeral_uint();
+            o  = cmp->get_orientation_numeral();
             lx = cmp->get_lx_numeral();
             ly = cmp->get_ly_numeral();
         }
@@ -250,7 +250,7 @@ void Plotter::draw_pin(Component* parent, Pin* pin)
     if (parent->is_free()){
         o = parent->get_solution_orientation(m_solution_id);
     } else {
-        o = static_cast<eOrientation>(parent->get_orientation().get_numeral_uint());
+        o = parent->get_orientation_numeral();
     }
     
    
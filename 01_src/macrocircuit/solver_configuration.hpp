@@ -0,0 +1,46 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : solver_configuration.hpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : Configuration of a Solver Pool Worker
+//==================================================================
+#ifndef SOLVER_CONFIGURATION_HPP
+#define SOLVER_CONFIGURATION_HPP
+
+#include <string>
+
+namespace Placer {
+
+struct SolverConfiguration {
+
+    SolverConfiguration(std::string const & _name,
+                        std::string const & _optsmt_engine,
+                        std::string const & _maxsat_engine,
+                        bool const _enable_sat,
+                        std::string const & _priority,
+                        unsigned const _seed)
+    {
+        name = _name;
+        optsmt_engine = _optsmt_engine;
+        maxsat_engine = _maxsat_engine;
+        enable_sat = _enable_sat;
+        priority = _priority;
+        seed = _seed;
+    }
+
+    std::string name;
+    std::string optsmt_engine;
+    std::string maxsat_engine;
+    bool enable_sat;
+    std::string priority;   ///< lex, pareto or box
+    unsigned seed;          ///< Permutes the assertion order, 0 keeps it
+};
+
+} /* namespace Placer */
+
+#endif /* SOLVER_CONFIGURATION_HPP */
@@ -0,0 +1,303 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : solver_pool.cpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : In-Process Pool of Z3 Optimizers
+//==================================================================
+#include "solver_pool.hpp"
+
+using namespace Placer;
+using namespace Placer::Utils;
+
+/**
+ * @brief Constructor
+ */
+SolverPool::SolverPool():
+    Object()
+{
+    m_logger = Logger::getInstance();
+    m_done = false;
+    m_winner = -1;
+}
+
+/**
+ * @brief Destructor
+ */
+SolverPool::~SolverPool()
+{
+    this->release_optimizers();
+
+    for (z3::context* itor: m_contexts){
+        delete itor; itor = nullptr;
+    }
+    m_logger = nullptr;
+}
+
+/**
+ * @brief Free the optimizers of the last run, the contexts are kept
+ */
+void SolverPool::release_optimizers()
+{
+    for (z3::optimize* itor: m_optimizers){
+        delete itor; itor = nullptr;
+    }
+    m_optimizers.clear();
+    m_objectives.clear();
+    m_results.clear();
+    m_done = false;
+    m_winner = -1;
+}
+
+/**
+ * @brief Add a worker configuration
+ *
+ * @param config Solver Configuration
+ */
+void SolverPool::add_configuration(SolverConfiguration const & config)
+{
+    m_configurations.push_back(config);
+}
+
+/**
+ * @brief Remove all worker configurations
+ */
+void SolverPool::clear_configurations()
+{
+    m_configurations.clear();
+}
+
+/**
+ * @brief Get number of configured workers
+ *
+ * @return size_t
+ */
+size_t SolverPool::get_num_configurations() const
+{
+    return m_configurations.size();
+}
+
+/**
+ * @brief Solve the problem with all configurations, the first worker
+ *        deciding the problem wins and interrupts all others
+ *
+ * If every worker runs into the timeout the best intermediate model is
+ * kept and unknown is returned, see has_model().
+ *
+ * @param opt Encoded problem living in the global Z3 context
+ * @return z3::check_result
+ */
+z3::check_result SolverPool::solve(z3::optimize & opt)
+{
+    assertion_check (!m_configurations.empty());
+
+    try {
+        this->release_optimizers();
+        m_logger->start_solver_pool(m_configurations.size());
+
+        while (m_contexts.size() < m_configurations.size()){
+            m_contexts.push_back(new z3::context());
+        }
+
+        // Z3 contexts are not thread safe, translate on the calling thread
+        for (size_t i = 0; i < m_configurations.size(); ++i){
+            m_optimizers.push_back(this->translate(i, opt));
+            m_results.push_back(z3::check_result::unknown);
+        }
+
+        std::vector<std::thread> workers;
+        for (size_t i = 0; i < m_optimizers.size(); ++i){
+            workers.push_back(std::thread(&SolverPool::run_worker, this, i));
+        }
+        for (std::thread& itor: workers){
+            itor.join();
+        }
+
+        if (m_winner < 0){
+            this->select_best_effort();
+            if (m_winner >= 0){
+                m_logger->solver_pool_best_effort(this->get_winner());
+            }
+            return z3::check_result::unknown;
+        }
+        m_logger->solver_pool_winner(this->get_winner());
+
+        return m_results[m_winner];
+    } catch (z3::exception const & exp){
+        throw PlacerException(exp.msg());
+    }
+}
+
+/**
+ * @brief Translate the problem into the context of a worker and apply its
+ *        configuration
+ *
+ * @param id Index of the worker
+ * @param opt Encoded problem living in the global Z3 context
+ * @return z3::optimize*
+ */
+z3::optimize* SolverPool::translate(size_t const id, z3::optimize & opt)
+{
+    SolverConfiguration const & config = m_configurations[id];
+    z3::context& ctx = *m_contexts[id];
+
+    z3::optimize* worker = new z3::optimize(ctx);
+    nullpointer_check (worker);
+
+    z3::expr_vector assertions(ctx, opt.assertions());
+    std::vector<size_t> order(assertions.size());
+    std::iota(order.begin(), order.end(), 0);
+    if (config.seed != 0){
+        std::shuffle(order.begin(), order.end(), std::mt19937(config.seed));
+    }
+    for (size_t i: order){
+        worker->add(assertions[i]);
+    }
+
+    // Objective order defines the lex priority and must be kept
+    z3::expr_vector objectives(ctx, opt.objectives());
+    for (size_t i = 0; i < objectives.size(); ++i){
+        worker->minimize(objectives[i]);
+    }
+    m_objectives.push_back(objectives);
+
+    z3::params param(ctx);
+    param.set("pb.compile_equality", true);
+    param.set("optsmt_engine", ctx.str_symbol(config.optsmt_engine.c_str()));
+    param.set("maxsat_engine", ctx.str_symbol(config.maxsat_engine.c_str()));
+    param.set("enable_sat", config.enable_sat);
+    param.set("priority", ctx.str_symbol(config.priority.c_str()));
+    if (this->get_timeout() != 0){
+        param.set("timeout", (unsigned)this->get_timeout() * 1000);
+    }
+    worker->set(param);
+
+    return worker;
+}
+
+/**
+ * @brief No worker decided the problem in time, take the worker whose
+ *        last model has the lexicographically smallest objectives
+ */
+void SolverPool::select_best_effort()
+{
+    std::vector<long long> best;
+
+    for (size_t i = 0; i < m_optimizers.size(); ++i){
+        try {
+            z3::model m = m_optimizers[i]->get_model();
+            if (m.size() == 0){
+                continue;
+            }
+
+            std::vector<long long> values;
+            for (size_t j = 0; j < m_objectives[i].size(); ++j){
+                values.push_back(m.eval(m_objectives[i][j], true).get_numeral_int64());
+            }
+            if ((m_winner < 0) || (values < best)){
+                best = values;
+                m_winner = i;
+            }
+        } catch (z3::exception const & exp){
+            // Worker has no usable model
+            continue;
+        }
+    }
+}
+
+/**
+ * @brief Worker Thread
+ *
+ * A worker starting after the problem was decided would miss the
+ * interrupt of its context, it gives up without solving.
+ *
+ * @param id Index of the worker
+ */
+void SolverPool::run_worker(size_t const id)
+{
+    z3::check_result result = z3::check_result::unknown;
+
+    try {
+        if (!m_done){
+            result = m_optimizers[id]->check();
+        }
+    } catch (z3::exception const & exp){
+        // Interrupted by a faster worker
+        result = z3::check_result::unknown;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_results[id] = result;
+
+    if ((m_winner < 0) && (result != z3::check_result::unknown)){
+        m_winner = id;
+        m_done = true;
+        for (size_t i = 0; i < m_contexts.size(); ++i){
+            if (i != id){
+                m_contexts[i]->interrupt();
+            }
+        }
+    }
+}
+
+/**
+ * @brief Continue with the winning configuration for the next solution
+ *
+ * @return z3::check_result
+ */
+z3::check_result SolverPool::next()
+{
+    assertion_check (m_winner >= 0);
+
+    try {
+        m_results[m_winner] = m_optimizers[m_winner]->check();
+
+        return m_results[m_winner];
+    } catch (z3::exception const & exp){
+        throw PlacerException(exp.msg());
+    }
+}
+
+/**
+ * @brief Get the model of the winning worker in the global Z3 context
+ *
+ * @return z3::model
+ */
+z3::model SolverPool::get_model()
+{
+    assertion_check (m_winner >= 0);
+
+    try {
+        z3::model m = m_optimizers[m_winner]->get_model();
+
+        return z3::model(m, m_z3_ctx, z3::model::translate());
+    } catch (z3::exception const & exp){
+        throw PlacerException(exp.msg());
+    }
+}
+
+/**
+ * @brief Check if a worker delivered a model
+ *
+ * @return bool
+ */
+bool SolverPool::has_model() const
+{
+    return m_winner >= 0;
+}
+
+/**
+ * @brief Get name of the winning configuration
+ *
+ * @return std::string
+ */
+std::string SolverPool::get_winner() const
+{
+    assertion_check (m_winner >= 0);
+
+    return m_configurations[m_winner].name;
+}
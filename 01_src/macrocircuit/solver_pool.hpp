@@ -0,0 +1,77 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : solver_pool.hpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : In-Process Pool of Z3 Optimizers
+//==================================================================
+#ifndef SOLVER_POOL_HPP
+#define SOLVER_POOL_HPP
+
+#include <object.hpp>
+#include <logger.hpp>
+#include <exception.hpp>
+#include <solver_configuration.hpp>
+
+#include <vector>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <numeric>
+#include <random>
+#include <algorithm>
+
+#include <z3++.h>
+
+namespace Placer {
+
+/**
+ * @class SolverPool
+ * @brief Runs an encoded optimization problem in several solver
+ *        configurations at once, each worker using its own Z3 context.
+ *        The first worker deciding the problem interrupts all others.
+ */
+class SolverPool: public virtual Object {
+public:
+    SolverPool();
+
+    virtual ~SolverPool();
+
+    void add_configuration(SolverConfiguration const & config);
+    void clear_configurations();
+    size_t get_num_configurations() const;
+
+    z3::check_result solve(z3::optimize & opt);
+    z3::check_result next();
+
+    z3::model get_model();
+    bool has_model() const;
+    std::string get_winner() const;
+
+private:
+    Utils::Logger* m_logger;
+
+    std::vector<SolverConfiguration> m_configurations;
+    std::vector<z3::context*> m_contexts;
+    std::vector<z3::optimize*> m_optimizers;
+    std::vector<z3::expr_vector> m_objectives;
+    std::vector<z3::check_result> m_results;
+
+    std::mutex m_mutex;
+    std::atomic<bool> m_done;
+    long m_winner;
+
+    void release_optimizers();
+    z3::optimize* translate(size_t const id, z3::optimize & opt);
+    void select_best_effort();
+    void run_worker(size_t const id);
+};
+
+} /* namespace Placer */
+
+#endif /* SOLVER_POOL_HPP */
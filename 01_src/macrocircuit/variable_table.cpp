@@ -0,0 +1,332 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : variable_table.cpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : Integer Indexed Table of all Solution Variables
+//==================================================================
+#include "variable_table.hpp"
+
+using namespace Placer;
+using namespace Placer::Utils;
+
+/**
+ * @brief Constructor
+ */
+VariableTable::VariableTable():
+    Object(),
+    m_variables(m_z3_ctx),
+    m_die_ux(-1),
+    m_die_uy(-1)
+{
+}
+
+/**
+ * @brief Destructor
+ */
+VariableTable::~VariableTable()
+{
+}
+
+/**
+ * @brief Drop all Slots
+ */
+void VariableTable::clear()
+{
+    m_variables = z3::expr_vector(m_z3_ctx);
+    m_die_ux = -1;
+    m_die_uy = -1;
+    m_components.clear();
+    m_pins.clear();
+    m_terminals.clear();
+}
+
+/**
+ * @brief Append an Expression and return its Slot
+ *
+ * @param variable Expression to evaluate
+ * @return size_t
+ */
+size_t VariableTable::add_variable(z3::expr const & variable)
+{
+    m_variables.push_back(variable);
+
+    return m_variables.size() - 1;
+}
+
+/**
+ * @brief Add the upper Corner of the Die
+ *
+ * @param ux UX Expression
+ * @param uy UY Expression
+ */
+void VariableTable::add_die(z3::expr const & ux, z3::expr const & uy)
+{
+    m_die_ux = this->add_variable(ux);
+    m_die_uy = this->add_variable(uy);
+}
+
+/**
+ * @brief Add a Component together with all its Pins
+ *
+ * @param component Component
+ */
+void VariableTable::add_component(Component* component)
+{
+    nullpointer_check (component);
+
+    ComponentSlots slots;
+    slots.component = component;
+    slots.lx = this->add_variable(component->get_lx());
+    slots.ly = this->add_variable(component->get_ly());
+    slots.orientation = this->add_variable(component->get_orientation());
+    m_components.push_back(slots);
+
+    for (Pin* pin: component->get_pins()){
+        PinSlots pin_slots;
+        pin_slots.pin = pin;
+        pin_slots.x = this->add_variable(pin->get_pin_pos_x());
+        pin_slots.y = this->add_variable(pin->get_pin_pos_y());
+        m_pins.push_back(pin_slots);
+    }
+}
+
+/**
+ * @brief Add a Terminal
+ *
+ * @param terminal Terminal
+ */
+void VariableTable::add_terminal(Terminal* terminal)
+{
+    nullpointer_check (terminal);
+
+    TerminalSlots slots;
+    slots.terminal = terminal;
+    slots.x = this->add_variable(terminal->get_pos_x());
+    slots.y = this->add_variable(terminal->get_pos_y());
+    m_terminals.push_back(slots);
+}
+
+/**
+ * @brief Get Number of Slots
+ *
+ * @return size_t
+ */
+size_t VariableTable::size() const
+{
+    return m_variables.size();
+}
+
+/**
+ * @brief Check if the Die is part of the Solution
+ *
+ * @return bool
+ */
+bool VariableTable::has_die() const
+{
+    return m_die_ux >= 0;
+}
+
+/**
+ * @brief Get Slot of the Die UX
+ *
+ * @return size_t
+ */
+size_t VariableTable::get_die_ux() const
+{
+    assertion_check (this->has_die());
+
+    return m_die_ux;
+}
+
+/**
+ * @brief Get Slot of the Die UY
+ *
+ * @return size_t
+ */
+size_t VariableTable::get_die_uy() const
+{
+    assertion_check (this->has_die());
+
+    return m_die_uy;
+}
+
+/**
+ * @brief Get Slots of all Components
+ *
+ * @return std::vector<ComponentSlots> const&
+ */
+std::vector<VariableTable::ComponentSlots> const & VariableTable::get_components() const
+{
+    return m_components;
+}
+
+/**
+ * @brief Get Slots of all Pins
+ *
+ * @return std::vector<PinSlots> const&
+ */
+std::vector<VariableTable::PinSlots> const & VariableTable::get_pins() const
+{
+    return m_pins;
+}
+
+/**
+ * @brief Get Slots of all Terminals
+ *
+ * @return std::vector<TerminalSlots> const&
+ */
+std::vector<VariableTable::TerminalSlots> const & VariableTable::get_terminals() const
+{
+    return m_terminals;
+}
+
+/**
+ * @brief Evaluate every Slot in a Model
+ *
+ * @param m Model
+ * @param values Value per Slot
+ */
+void VariableTable::evaluate(z3::model const & m, std::vector<size_t> & values) const
+{
+    values.resize(m_variables.size());
+
+    for (size_t i = 0; i < m_variables.size(); ++i){
+        values[i] = m.eval(m_variables[i]).get_numeral_uint64();
+    }
+}
+
+/**
+ * @brief Query for all Slots in a single SMT-LIB get-value Command
+ *
+ * @return std::string
+ */
+std::string VariableTable::get_value_query() const
+{
+    std::stringstream query;
+
+    query << "(get-value (";
+    for (size_t i = 0; i < m_variables.size(); ++i){
+        query << (i == 0 ? "" : " ") << m_variables[i];
+    }
+    query << "))";
+
+    return query.str();
+}
+
+/**
+ * @brief Convert an Integer or Bit-Vector Literal
+ *
+ * @param token Decimal, #x.. or #b.. Literal, #d.. is used internally
+ *              for (_ bvN width)
+ * @return size_t
+ */
+size_t VariableTable::parse_numeral(std::string const & token)
+{
+    int base = 10;
+    size_t begin = 0;
+    if (token.rfind("#x", 0) == 0){
+        base = 16;
+        begin = 2;
+    } else if (token.rfind("#b", 0) == 0){
+        base = 2;
+        begin = 2;
+    } else if (token.rfind("#d", 0) == 0){
+        begin = 2;
+    }
+
+    if (begin == token.size() || !std::isxdigit(static_cast<unsigned char>(token[begin]))){
+        throw PlacerException("Can not parse Solver Value (" + token + ")");
+    }
+
+    size_t end = 0;
+    size_t value = 0;
+    try {
+        value = std::stoull(token.substr(begin), &end, base);
+    } catch (std::exception const & exp){
+        throw PlacerException("Can not parse Solver Value (" + token + ")");
+    }
+    if (begin + end != token.size()){
+        throw PlacerException("Can not parse Solver Value (" + token + ")");
+    }
+
+    return value;
+}
+
+/**
+ * @brief Read the Response of the get-value Query
+ *
+ * The response holds one (expression value) pair per slot in query order,
+ * so the values are taken positionally and the expressions are skipped.
+ * Values are decimal integers or bit-vector literals, #x.., #b.. and
+ * (_ bvN width).
+ *
+ * @param response Balanced Response of the Solver
+ * @param values Value per Slot
+ * @return bool False if the Response does not answer the Query
+ */
+bool VariableTable::parse_values(std::string const & response, std::vector<size_t> & values) const
+{
+    values.clear();
+
+    size_t depth = 0;
+    std::string token;
+    std::string last;
+    std::vector<std::string> nested;
+    std::vector<std::string> literals;
+
+    for (size_t i = 0; i <= response.size(); ++i){
+        char c = (i < response.size()) ? response[i] : ' ';
+
+        if (c == '(' || c == ')' || std::isspace(static_cast<unsigned char>(c))){
+            if (!token.empty() && depth == 2){
+                last = token;
+            } else if (!token.empty() && depth == 3){
+                nested.push_back(token);
+            }
+            token.clear();
+
+            if (c == '('){
+                depth++;
+                // Expressions inside a pair are never the value
+                if (depth > 2){
+                    last.clear();
+                }
+                if (depth == 3){
+                    nested.clear();
+                }
+            } else if (c == ')'){
+                if (depth == 0){
+                    return false;
+                }
+                if (depth == 3 && nested.size() == 3 && nested[0] == "_" && nested[1].rfind("bv", 0) == 0){
+                    last = "#d" + nested[1].substr(2);
+                }
+                if (depth == 2){
+                    if (last.empty()){
+                        return false;
+                    }
+                    literals.push_back(last);
+                    last.clear();
+                }
+                depth--;
+            }
+        } else {
+            token += c;
+        }
+    }
+
+    // Other responses, e.g. objectives, may hold symbols like oo
+    if ((depth != 0) || (literals.size() != m_variables.size())){
+        return false;
+    }
+    for (std::string const & itor: literals){
+        values.push_back(parse_numeral(itor));
+    }
+
+    return true;
+}
@@ -0,0 +1,108 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : variable_table.hpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : Integer Indexed Table of all Solution Variables
+//==================================================================
+#ifndef VARIABLE_TABLE_HPP
+#define VARIABLE_TABLE_HPP
+
+#include <object.hpp>
+#include <component.hpp>
+#include <terminal.hpp>
+#include <pin.hpp>
+#include <exception.hpp>
+
+#include <z3++.h>
+
+#include <vector>
+#include <string>
+#include <sstream>
+#include <cctype>
+
+namespace Placer {
+
+/**
+ * @class VariableTable
+ *
+ * @brief Every expression a solution is read from gets a dense slot at
+ *        encode time. Extracting a model is a single pass over the slots
+ *        and fills a flat value array, the owners are resolved through
+ *        the slot indices kept per Component, Pin and Terminal.
+ */
+class VariableTable: public virtual Object {
+public:
+    /**
+     * @brief Slots of a Component
+     */
+    struct ComponentSlots {
+        Component* component;
+        size_t lx;
+        size_t ly;
+        size_t orientation;
+    };
+
+    /**
+     * @brief Slots of a Pin
+     */
+    struct PinSlots {
+        Pin* pin;
+        size_t x;
+        size_t y;
+    };
+
+    /**
+     * @brief Slots of a Terminal
+     */
+    struct TerminalSlots {
+        Terminal* terminal;
+        size_t x;
+        size_t y;
+    };
+
+    VariableTable();
+
+    virtual ~VariableTable();
+
+    void clear();
+
+    void add_die(z3::expr const & ux, z3::expr const & uy);
+    void add_component(Component* component);
+    void add_terminal(Terminal* terminal);
+
+    size_t size() const;
+    bool has_die() const;
+    size_t get_die_ux() const;
+    size_t get_die_uy() const;
+
+    std::vector<ComponentSlots> const & get_components() const;
+    std::vector<PinSlots> const & get_pins() const;
+    std::vector<TerminalSlots> const & get_terminals() const;
+
+    void evaluate(z3::model const & m, std::vector<size_t> & values) const;
+
+    std::string get_value_query() const;
+    bool parse_values(std::string const & response, std::vector<size_t> & values) const;
+
+private:
+    size_t add_variable(z3::expr const & variable);
+    static size_t parse_numeral(std::string const & token);
+
+    z3::expr_vector m_variables;
+
+    long m_die_ux;
+    long m_die_uy;
+
+    std::vector<ComponentSlots> m_components;
+    std::vector<PinSlots> m_pins;
+    std::vector<TerminalSlots> m_terminals;
+};
+
+} /* namespace Placer */
+
+#endif /* VARIABLE_TABLE_HPP */
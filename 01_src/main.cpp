@@ -10,9 +10,19 @@
 // Description  : Macro Placer Frontend
 //==================================================================
 #include <placer.hpp>
+#include <batch.hpp>
 
 int main (int argc, char ** argv)
 {
+    if (Placer::BatchRunner::is_batch(argc, argv)){
+        Placer::BatchRunner* batch = new Placer::BatchRunner(argc, argv);
+        int status = batch->run();
+
+        delete batch; batch = nullptr;
+
+        return status;
+    }
+
     Placer::MacroPlacer* placer = new Placer::MacroPlacer(argc, argv);
     placer->init();
     placer->run();
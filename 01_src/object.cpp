@@ -10,68 +10,15 @@
 // Description  : Virtual Base Class
 //==================================================================
 #include "object.hpp"
+#include "placement_context.hpp"
 
 using namespace Placer;
 
-std::string Object::m_def;
-std::string Object::m_site;
-std::string Object::m_supplement;
-std::string Object::m_working_directory;
-std::string Object::m_results_directory;
-std::string Object::m_image_directory;
-std::string Object::m_smt_directory;
-std::string Object::m_log_name;
-std::string Object::m_parquet_directory;
-std::string Object::m_bookshelf_file;
-std::string Object::m_bookshelf_export;
-std::string Object::m_design_name;
-std::string Object::m_binary_name;
-std::string Object::m_database_file;
-std::string Object::m_db_to_csv_script;
-std::string Object::m_base_path;
-std::string Object::m_ini_file;
-std::string Object::m_hl_backend_ip;
-eSolverBackend Object::m_solver_backend;
-std::vector<std::string> Object::m_lef;
-bool Object::m_verbose = false;
-bool Object::m_log = false;
-bool Object::m_min_die_mode = false;
-bool Object::m_min_hpwl_mode = false;
-bool Object::m_smt_to_filesystem = false;
-bool Object::m_save_all = false;
-bool Object::m_save_best = false;
-bool Object::m_dump_all = false;
-bool Object::m_dump_best = false;
-bool Object::m_store_smt = false;
-bool Object::m_pareto_optimizer = false;
-bool Object::m_lex_optimizer = false;
-bool Object::m_partitioning = false;
-bool Object::m_parquet_fp = false;
-bool Object::m_free_terminals = false;
-bool Object::m_free_components = false;
-bool Object::m_strip_terminals = false;
-bool Object::m_skip_power_network = false;
-bool Object::m_store_db = false;
-bool Object::m_z3_shell_mode = false;
-bool Object::m_z3_api_mode = false;
-size_t Object::m_timeout = 0;
-size_t Object::m_bitwidth_orientation;
-size_t Object::m_solutions = 1;
-size_t Object::m_results_id = 0;
-size_t Object::m_partition_id = 0;
-size_t Object::m_partition_size = 1;
-size_t Object::m_num_partitions = 1;
-size_t Object::m_key_counter = 0;
-size_t Object::m_def_units = 0;
-size_t Object::m_lef_units = 0;
-size_t Object::m_hl_backend_port;
-eLogic Object::m_logic = eInt;
-
-z3::context Object::m_z3_ctx(init_context());
-z3::expr_vector Object::m_stored_constraints(m_z3_ctx);
-
-
-Object::Object()
+Object::Object():
+    m_z3_ctx(PlacementContext::current()->m_z3_ctx),
+    m_z3_mutex(PlacementContext::current()->m_z3_mutex),
+    m_key_counter(PlacementContext::current()->m_key_counter),
+    m_context(PlacementContext::current())
 {
 }
 
@@ -79,458 +26,454 @@ Object::~Object()
 {
 }
 
-z3::context Object::init_context()
+/**
+ * @brief Assignment keeps the Context the Object was constructed in
+ */
+Object& Object::operator=(Object const &)
 {
-    z3::config cfg;
-   
-    return z3::context(cfg);
+    return *this;
+}
+
+PlacementContext* Object::get_context() const
+{
+    return m_context;
 }
 
 void Object::add_def(std::string const & def)
 {
-    m_def = def;
+    m_context->m_def = def;
 }
 
 void Object::add_lef(std::string const & lef)
 {
-    m_lef.push_back(lef);
+    m_context->m_lef.push_back(lef);
 }
 
 std::string& Object::get_def() const
 {
-    return m_def;
+    return m_context->m_def;
 }
 
 std::vector<std::string>& Object::get_lef() const
 {
-    return m_lef;
+    return m_context->m_lef;
 }
 
 std::string& Object::get_site() const
 {
-    return m_site;
+    return m_context->m_site;
 }
 
 void Object::set_site(std::string const & site)
 {
-    m_site = site;
+    m_context->m_site = site;
 }
 
 std::string& Object::get_supplement() const
 {
-    return m_supplement;
+    return m_context->m_supplement;
 }
 
 void Object::set_supplement(std::string const & file)
 {
-    m_supplement = file;
+    m_context->m_supplement = file;
 }
 
 void Object::set_working_directory(std::string const & dir)
 {
-    m_working_directory = dir;
+    m_context->m_working_directory = dir;
 }
 
 std::string& Object::get_working_directory() const
 {
-    return m_working_directory;
+    return m_context->m_working_directory;
 }
 
 std::string& Object::get_results_directory() const
 {
-    return m_results_directory;
+    return m_context->m_results_directory;
 }
 
 void Object::set_results_directory(std::string const & name)
 {
-    m_results_directory = m_working_directory + "/" + name;
+    m_context->m_results_directory = m_context->m_working_directory + "/" + name;
 }
 
 std::string& Object::get_image_directory() const
 {
-    return m_image_directory;
+    return m_context->m_image_directory;
 }
 
 void Object::set_image_directory(std::string const & name)
 {
-    m_image_directory = 
-        m_results_directory + "/"
-        + std::to_string(m_results_id) + "/" 
+    m_context->m_image_directory = 
+        m_context->m_results_directory + "/"
+        + std::to_string(m_context->m_results_id) + "/" 
         + name;
 }
 
 bool Object::get_verbose() const
 {
-    return m_verbose;
+    return m_context->m_verbose;
 }
 
 void Object::set_verbose(bool const val)
 {
-    m_verbose = val;
+    m_context->m_verbose = val;
 }
 
 bool Object::get_log_active() const
 {
-    return m_log;
+    return m_context->m_log;
 }
 
 void Object::set_log_active(bool const val)
 {
-    m_log = val;
+    m_context->m_log = val;
 }
 
 std::string Object::get_active_results_directory()
 {
-    return m_results_directory + "/" + std::to_string(m_results_id);
+    return m_context->m_results_directory + "/" + std::to_string(m_context->m_results_id);
 }
 
 std::string Object::get_smt_directory() const
 {
-    return m_smt_directory;
+    return m_context->m_smt_directory;
 }
 
 void Object::set_smt_directory(std::string const & name)
 {
-    m_smt_directory = 
-        m_results_directory + "/" 
-        + std::to_string(m_results_id) 
+    m_context->m_smt_directory = 
+        m_context->m_results_directory + "/" 
+        + std::to_string(m_context->m_results_id) 
         + "/" + name;
 }
 
 std::string Object::get_log_name() const
 {
-    return m_log_name;
+    return m_context->m_log_name;
 }
 
 void Object::set_log_name(std::string const & log_name)
 {
-    m_log_name = log_name;
+    m_context->m_log_name = log_name;
 }
 
 std::string Object::get_parquet_directory() const
 {
-    return m_parquet_directory;
+    return m_context->m_parquet_directory;
 }
 
 void Object::set_parquet_directory(std::string const & directory)
 {
-    m_parquet_directory = 
-        m_results_directory + "/"
-        + std::to_string(m_results_id) + "/" 
+    m_context->m_parquet_directory = 
+        m_context->m_results_directory + "/"
+        + std::to_string(m_context->m_results_id) + "/" 
         + directory;
 }
 
 void Object::set_bookshelf_file(std::string const & file)
 {
-    m_bookshelf_file = file;
+    m_context->m_bookshelf_file = file;
 }
 
 std::string Object::get_bookshelf_file() const
 {
-    return m_bookshelf_file;
+    return m_context->m_bookshelf_file;
 }
 
 std::string Object::get_bookshelf_export() const
 {
-    return m_bookshelf_export;
+    return m_context->m_bookshelf_export;
 }
 
 void Object::set_bookshelf_export(std::string const & name)
 {
-    m_bookshelf_export = name;
+    m_context->m_bookshelf_export = name;
 }
 
 size_t Object::get_timeout() const
 {
-    return m_timeout;
+    return m_context->m_timeout;
 }
 
 void Object::set_timeout(size_t const val)
 {
-    m_timeout = val;
+    m_context->m_timeout = val;
 }
 
 bool Object::get_minimize_die_mode() const
 {
-    return m_min_die_mode;
+    return m_context->m_min_die_mode;
 }
 
 void Object::set_minimize_die_mode(bool const val)
 {
-    m_min_die_mode = val;
+    m_context->m_min_die_mode = val;
 }
 
 bool Object::get_minimize_hpwl_mode() const
 {
-    return m_min_hpwl_mode;
+    return m_context->m_min_hpwl_mode;
 }
 
 void Object::set_minimize_hpwl_mode(bool const val)
 {
-    m_min_hpwl_mode = val;
+    m_context->m_min_hpwl_mode = val;
 }
 
 size_t Object::get_max_solutions() const
 {
-    return m_solutions;
+    return m_context->m_solutions;
 }
 
 void Object::set_max_solutions(size_t const val)
 {
-    m_solutions = val;
+    m_context->m_solutions = val;
 }
 
 bool Object::get_smt_to_filesystem() const
 {
-    return m_smt_to_filesystem;
+    return m_context->m_smt_to_filesystem;
 }
 
 void Object::set_smt_to_filesystem(bool const val)
 {
-    m_smt_to_filesystem = val;
+    m_context->m_smt_to_filesystem = val;
 }
 
 bool Object::get_dump_all() const
 {
-    return m_dump_all;
+    return m_context->m_dump_all;
 }
 
 bool Object::get_dump_best() const
 {
-    return m_dump_best;
+    return m_context->m_dump_best;
 }
 
 bool Object::get_save_all() const
 {
-    return m_save_all;
+    return m_context->m_save_all;
 }
 
 bool Object::get_save_best() const
 {
-    return m_save_best;
+    return m_context->m_save_best;
 }
 
 void Object::set_dump_all(bool const val)
 {
-    m_dump_all = val;
+    m_context->m_dump_all = val;
 }
 
 void Object::set_dump_best(bool const val)
 {
-    m_dump_best = val;
+    m_context->m_dump_best = val;
 }
 
 void Object::set_save_best(bool const val)
 {
-    m_save_best = val;
+    m_context->m_save_best = val;
 }
 
 void Object::set_save_all(bool const val)
 {
-    m_save_all = val;
+    m_context->m_save_all = val;
 }
 
 bool Object::get_store_smt() const
 {
-    return m_store_smt;
+    return m_context->m_store_smt;
 }
 
 void Object::set_store_smt(bool const val)
 {
-    m_store_smt = val;
+    m_context->m_store_smt = val;
 }
 
 std::string Object::get_design_name() const
 {
-    return m_design_name;
+    return m_context->m_design_name;
 }
 
 void Object::set_design_name(std::string const & name)
 {
-    m_design_name = name;
+    m_context->m_design_name = name;
 }
 
 void Object::set_binary_name(std::string const & name)
 {
-    m_binary_name = name;
+    m_context->m_binary_name = name;
 }
 
 std::string Object::get_binary_name() const
 {
-    return m_binary_name;
+    return m_context->m_binary_name;
 }
 
 size_t Object::get_bitwidth_orientation() const
 {
-    return m_bitwidth_orientation;
+    return m_context->m_bitwidth_orientation;
 }
 
 void Object::set_bitwidth_orientation(size_t const bitwidth)
 {
-    m_bitwidth_orientation = bitwidth;
+    m_context->m_bitwidth_orientation = bitwidth;
 }
 
 bool Object::get_pareto_optimizer() const
 {
-    return m_pareto_optimizer;
+    return m_context->m_pareto_optimizer;
 }
 
 void Object::set_pareto_optimizer(bool const val)
 {
-    m_pareto_optimizer = val;
+    m_context->m_pareto_optimizer = val;
 }
 
 bool Object::get_lex_optimizer() const
 {
-    return m_lex_optimizer;
+    return m_context->m_lex_optimizer;
 }
 
 void Object::set_lex_optimizer(bool const val)
 {
-    m_lex_optimizer = val;
+    m_context->m_lex_optimizer = val;
 }
 
 bool Object::get_parquet_fp() const
 {
-    return m_parquet_fp;
+    return m_context->m_parquet_fp;
 }
 
 void Object::set_parquet_fp(bool const val)
 {
-    m_parquet_fp = val;
+    m_context->m_parquet_fp = val;
 }
 
 size_t Object::get_results_id() const
 {
-    return m_results_id;
+    return m_context->m_results_id;
 }
 
 void Object::set_results_id(size_t const id)
 {
-    m_results_id = id;
+    m_context->m_results_id = id;
 }
 
 bool Object::get_partitioning() const
 {
-    return m_partitioning;
+    return m_context->m_partitioning;
 }
 
 void Object::set_partitioning(bool const val)
 {
-    m_partitioning = val;
+    m_context->m_partitioning = val;
 }
 
 size_t Object::get_num_partitions() const 
 {
-    return m_num_partitions;
+    return m_context->m_num_partitions;
 }
 
 void Object::set_num_partition(size_t const num)
 {
-    m_num_partitions = num;
+    m_context->m_num_partitions = num;
 }
 
 size_t Object::get_partition_id()
 {
-    size_t id = m_partition_id;
-    m_partition_id++;
+    size_t id = m_context->m_partition_id;
+    m_context->m_partition_id++;
 
     return id;
 }
 
 size_t Object::get_partition_size() const
 {
-    return m_partition_size;
+    return m_context->m_partition_size;
 }
 
 void Object::set_partition_size(size_t const val)
 {
-    m_partition_size = val;
+    m_context->m_partition_size = val;
 }
 
 eLogic Object::get_logic() const
 {
-    return m_logic;
+    return m_context->m_logic;
 }
 
 void Object::set_logic(eLogic const logic)
 {
-    m_logic = logic;
+    m_context->m_logic = logic;
 }
 
 void Object::store_constraint(z3::expr const & constraint)
 {
-    m_stored_constraints.push_back(constraint);
+    m_context->m_stored_constraints.push_back(constraint);
 }
 
 z3::expr_vector Object::get_stored_constraints()
 {
-    return m_stored_constraints;
+    return m_context->m_stored_constraints;
 }
 
 bool Object::get_free_terminals() const
 {
-    return m_free_terminals;
+    return m_context->m_free_terminals;
 }
 
 void Object::set_free_terminals(bool const value)
 {
-    m_free_terminals = value;
+    m_context->m_free_terminals = value;
 }
 
 bool Object::get_free_components() const
 {
-    return m_free_components;
+    return m_context->m_free_components;
 }
 
 void Object::set_free_components(bool const value)
 {
-    m_free_components = value;
+    m_context->m_free_components = value;
 }
 
 void Object::set_strip_terminals(bool const val)
 {
-    m_strip_terminals = val;
+    m_context->m_strip_terminals = val;
 }
 
 bool Object::get_strip_terminals() const
 {
-    return m_strip_terminals;
+    return m_context->m_strip_terminals;
 }
 
 std::string Object::get_database_file()
 {
-    return m_database_file;
+    return m_context->m_database_file;
 }
 
 void Object::set_database_file(std::string const & name)
 {
-    m_database_file = name;
+    m_context->m_database_file = name;
 }
 
 std::string Object::get_database_dir()
 {
-    return m_results_directory + "/" + std::to_string(m_results_id) + "/";
-}
-
-std::string Object::get_db_to_csv_script() const
-{
-    return m_db_to_csv_script;
-}
-
-void Object::set_db_to_csv_script(std::string const & url)
-{
-    m_db_to_csv_script = url;
+    return m_context->m_results_directory + "/" + std::to_string(m_context->m_results_id) + "/";
 }
 
 std::string Object::get_base_path() const
 {
-    return m_base_path;
+    return m_context->m_base_path;
 }
 
 void Object::set_base_path(std::string const & path)
 {
-    m_base_path = path;
+    m_context->m_base_path = path;
 }
 
 std::string Object::orientation_to_string(eOrientation const orientation)
@@ -560,26 +503,26 @@ std::string Object::orientation_to_string(eOrientation const orientation)
 
 bool Object::get_skip_power_network() const
 {
-    return m_skip_power_network;
+    return m_context->m_skip_power_network;
 }
 
 void Object::set_skip_power_network(bool const val)
 {
-    m_skip_power_network = val;
+    m_context->m_skip_power_network = val;
 }
 
 std::string Object::get_ini_file() const
 {
-    return m_ini_file;
+    return m_context->m_ini_file;
 }
 
 void Object::set_ini_file(std::string const & file)
 {
     std::vector<std::string> token = Utils::Utils::tokenize(file, ".");
     if (token.size() == 1){ 
-        m_ini_file = file + ".ini";
+        m_context->m_ini_file = file + ".ini";
     } else {
-        m_ini_file = file;
+        m_context->m_ini_file = file;
     }
 }
 
@@ -590,84 +533,214 @@ std::string Object::get_third_party_bin()
 
 void Object::set_store_to_db(bool const value)
 {
-    m_store_db = value;
+    m_context->m_store_db = value;
 }
 
 bool Object::get_store_to_db() const 
 {
-    return m_store_db;
+    return m_context->m_store_db;
 }
 
 void Object::set_def_units(size_t const value)
 {
-    m_def_units = value;
+    m_context->m_def_units = value;
 }
 
 size_t Object::get_def_units() const
 {
-    assert (m_def_units > 0);
+    assert (m_context->m_def_units > 0);
 
-    return m_def_units;
+    return m_context->m_def_units;
 }
 
 void Object::set_lef_units(size_t const value)
 {
-    m_lef_units = value;
+    m_context->m_lef_units = value;
 }
 
 size_t Object::get_lef_units() const
 {
-    assert (m_lef_units > 0);
+    assert (m_context->m_lef_units > 0);
 
-    return m_lef_units;
+    return m_context->m_lef_units;
 }
 
 bool Object::get_z3_api_mode() const
 {
-    return m_z3_api_mode;
+    return m_context->m_z3_api_mode;
 }
 
 bool Object::get_z3_shell_mode() const
 {
-    return m_z3_shell_mode;
+    return m_context->m_z3_shell_mode;
 }
 
 void Object::set_z3_api_mode(bool const val)
 {
-    m_z3_api_mode = val;
+    m_context->m_z3_api_mode = val;
 }
 
 void Object::set_z3_shell_mode(bool const val)
 {
-    m_z3_shell_mode = val;
+    m_context->m_z3_shell_mode = val;
 }
 
 eSolverBackend Object::get_solver_backend() const
 {
-    return m_solver_backend;
+    return m_context->m_solver_backend;
 }
 
 void Object::set_solver_backend(eSolverBackend const & backend)
 {
-    m_solver_backend = backend;
+    m_context->m_solver_backend = backend;
 }
 
 void Object::set_hl_backend_ip(std::string const & ip)
 {
-    m_hl_backend_ip = ip;
+    m_context->m_hl_backend_ip = ip;
 }
 
 std::string Object::get_hl_backend_ip()
 {
-    return m_hl_backend_ip;
+    return m_context->m_hl_backend_ip;
 }
 
 void Object::set_hl_backend_port(size_t const port)
 {
-    m_hl_backend_port = port;
+    m_context->m_hl_backend_port = port;
 }
 
 size_t Object::get_hl_backend_port()
 {
-    return m_hl_backend_port;
+    return m_context->m_hl_backend_port;
+}
+
+void Object::set_symmetry_breaking(bool const val)
+{
+    m_context->m_symmetry_breaking = val;
+}
+
+bool Object::get_symmetry_breaking() const
+{
+    return m_context->m_symmetry_breaking;
+}
+
+void Object::set_incremental(bool const val)
+{
+    m_context->m_incremental = val;
+}
+
+bool Object::get_incremental() const
+{
+    return m_context->m_incremental;
+}
+
+void Object::set_solver_workers(size_t const val)
+{
+    m_context->m_solver_workers = val;
+}
+
+size_t Object::get_solver_workers() const
+{
+    return m_context->m_solver_workers;
+}
+
+void Object::set_portfolio(bool const val)
+{
+    m_context->m_portfolio = val;
+}
+
+bool Object::get_portfolio() const
+{
+    return m_context->m_portfolio;
+}
+
+void Object::set_hierarchical(bool const val)
+{
+    m_context->m_hierarchical = val;
+}
+
+bool Object::get_hierarchical() const
+{
+    return m_context->m_hierarchical;
+}
+
+void Object::set_leaf_size(size_t const val)
+{
+    m_context->m_leaf_size = val;
+}
+
+size_t Object::get_leaf_size() const
+{
+    return m_context->m_leaf_size;
+}
+
+void Object::set_floorplan_cache(std::string const & directory)
+{
+    m_context->m_floorplan_cache = directory;
+}
+
+std::string Object::get_floorplan_cache() const
+{
+    return m_context->m_floorplan_cache;
+}
+
+void Object::set_snapshot_cache(std::string const & directory)
+{
+    m_context->m_snapshot_cache = directory;
+}
+
+std::string Object::get_snapshot_cache() const
+{
+    return m_context->m_snapshot_cache;
+}
+
+void Object::set_lef_cache(std::string const & directory)
+{
+    m_context->m_lef_cache = directory;
+}
+
+std::string Object::get_lef_cache() const
+{
+    return m_context->m_lef_cache;
+}
+
+void Object::set_bbox_hpwl(bool const val)
+{
+    m_context->m_bbox_hpwl = val;
+}
+
+bool Object::get_bbox_hpwl() const
+{
+    return m_context->m_bbox_hpwl;
+}
+
+void Object::set_skip_cells(bool const val)
+{
+    m_context->m_skip_cells = val;
+}
+
+bool Object::get_skip_cells() const
+{
+    return m_context->m_skip_cells;
+}
+
+void Object::set_async_db(bool const val)
+{
+    m_context->m_async_db = val;
+}
+
+bool Object::get_async_db() const
+{
+    return m_context->m_async_db;
+}
+
+void Object::set_export_results(bool const val)
+{
+    m_context->m_export_results = val;
+}
+
+bool Object::get_export_results() const
+{
+    return m_context->m_export_results;
 }
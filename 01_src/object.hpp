@@ -18,11 +18,15 @@
 #include <vector>
 #include <string>
 #include <functional>
+#include <atomic>
+#include <mutex>
 
 #include <z3++.h>
 
 namespace Placer {
 
+class PlacementContext;
+
 enum eRotation {eFixed, e2D, e4D};
 enum eLogic {eInt, eBitVector};
 enum eInputFormat {eLEFDEF, eBookshelf};
@@ -42,13 +46,17 @@ enum eOrientation {
 /**
  * @class Object
  * 
- * @brief Static Superclass for configuration settings
+ * @brief Superclass for configuration settings, all settings live in the
+ *        PlacementContext the Object was constructed in
  */
 class Object {
 public:
     virtual ~Object();
 protected:
     Object();
+    Object(Object const & other) = default;
+
+    Object& operator=(Object const & other);
 
     void add_lef(std::string const & lef);
     std::vector<std::string>& get_lef() const;
@@ -174,8 +182,6 @@ protected:
     std::string get_database_file();
     std::string get_database_dir();
 
-    void set_db_to_csv_script(std::string const & url);
-    std::string get_db_to_csv_script() const;
 
     void set_base_path(std::string const & path);
     std::string get_base_path() const;
@@ -214,65 +220,53 @@ protected:
     void set_hl_backend_port(size_t const port);
     size_t get_hl_backend_port();
 
-    static z3::context m_z3_ctx;
-    static size_t m_key_counter;
+    void set_symmetry_breaking(bool const val);
+    bool get_symmetry_breaking() const;
+
+    void set_incremental(bool const val);
+    bool get_incremental() const;
+
+    void set_solver_workers(size_t const val);
+    size_t get_solver_workers() const;
+
+    void set_portfolio(bool const val);
+    bool get_portfolio() const;
+
+    void set_hierarchical(bool const val);
+    bool get_hierarchical() const;
+
+    void set_leaf_size(size_t const val);
+    size_t get_leaf_size() const;
+
+    void set_floorplan_cache(std::string const & directory);
+    std::string get_floorplan_cache() const;
+
+    void set_snapshot_cache(std::string const & directory);
+    std::string get_snapshot_cache() const;
+
+    void set_lef_cache(std::string const & directory);
+    std::string get_lef_cache() const;
+
+    void set_bbox_hpwl(bool const val);
+    bool get_bbox_hpwl() const;
+
+    void set_skip_cells(bool const val);
+    bool get_skip_cells() const;
+
+    void set_async_db(bool const val);
+    bool get_async_db() const;
+
+    void set_export_results(bool const val);
+    bool get_export_results() const;
+
+    PlacementContext* get_context() const;
+
+    z3::context& m_z3_ctx;
+    std::mutex& m_z3_mutex;
+    std::atomic<size_t>& m_key_counter;
 
 private:
-    static std::vector<std::string> m_lef;
-    static std::string m_def;
-    static std::string m_site;
-    static std::string m_supplement;
-    static std::string m_base_path;
-    static std::string m_working_directory;
-    static std::string m_results_directory;
-    static std::string m_image_directory;
-    static std::string m_smt_directory;
-    static std::string m_parquet_directory;
-    static std::string m_log_name;
-    static std::string m_bookshelf_file;
-    static std::string m_bookshelf_export;
-    static std::string m_design_name;
-    static std::string m_binary_name;
-    static std::string m_database_file;
-    static std::string m_db_to_csv_script;
-    static std::string m_ini_file;
-    static std::string m_hl_backend_ip;
-    static eSolverBackend m_solver_backend;
-    static size_t m_hl_backend_port;
-    static size_t m_timeout;
-    static size_t m_bitwidth_orientation;
-    static size_t m_partition_id;
-    static bool m_verbose;
-    static bool m_log;
-    static bool m_min_die_mode;
-    static bool m_min_hpwl_mode;
-    static bool m_smt_to_filesystem;
-    static bool m_save_all;
-    static bool m_save_best;
-    static bool m_dump_all;
-    static bool m_dump_best;
-    static bool m_store_smt;
-    static bool m_store_db;
-    static bool m_pareto_optimizer;
-    static bool m_lex_optimizer;
-    static bool m_parquet_fp;
-    static bool m_partitioning;
-    static bool m_free_terminals;
-    static bool m_free_components;
-    static bool m_strip_terminals;
-    static bool m_skip_power_network;
-    static bool m_z3_api_mode;
-    static bool m_z3_shell_mode;
-    static size_t m_partition_size;
-    static size_t m_num_partitions;
-    static size_t m_solutions;
-    static size_t m_results_id;
-    static size_t m_def_units;
-    static size_t m_lef_units;
-    static eLogic m_logic;
-    static z3::expr_vector m_stored_constraints;
-
-    static z3::context init_context();
+    PlacementContext* m_context;
 };
 
 } /* namespace Placer */
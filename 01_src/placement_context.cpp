@@ -0,0 +1,111 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : placement_context.cpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : State of a single Placement Run
+//==================================================================
+#include "placement_context.hpp"
+
+using namespace Placer;
+
+thread_local PlacementContext* PlacementContext::p_current = nullptr;
+
+/**
+ * @brief Constructor
+ */
+PlacementContext::PlacementContext():
+    m_key_counter(0),
+    m_solver_backend(eZ3),
+    m_hl_backend_port(0),
+    m_timeout(0),
+    m_bitwidth_orientation(0),
+    m_partition_id(0),
+    m_verbose(false),
+    m_log(false),
+    m_min_die_mode(false),
+    m_min_hpwl_mode(false),
+    m_smt_to_filesystem(false),
+    m_save_all(false),
+    m_save_best(false),
+    m_dump_all(false),
+    m_dump_best(false),
+    m_store_smt(false),
+    m_store_db(false),
+    m_pareto_optimizer(false),
+    m_lex_optimizer(false),
+    m_parquet_fp(false),
+    m_partitioning(false),
+    m_free_terminals(false),
+    m_free_components(false),
+    m_strip_terminals(false),
+    m_skip_power_network(false),
+    m_z3_api_mode(false),
+    m_z3_shell_mode(false),
+    m_symmetry_breaking(false),
+    m_incremental(false),
+    m_portfolio(false),
+    m_hierarchical(false),
+    m_bbox_hpwl(false),
+    m_skip_cells(false),
+    m_async_db(false),
+    m_export_results(false),
+    m_leaf_size(8),
+    m_partition_size(1),
+    m_solver_workers(1),
+    m_num_partitions(1),
+    m_solutions(1),
+    m_results_id(0),
+    m_def_units(0),
+    m_lef_units(0),
+    m_logic(eInt),
+    m_stored_constraints(m_z3_ctx)
+{
+}
+
+/**
+ * @brief Destructor
+ */
+PlacementContext::~PlacementContext()
+{
+}
+
+/**
+ * @brief Get the Context of the calling Thread
+ *
+ * Threads outside of any Scope share the process default context, this
+ * is what a single command line run works in.
+ *
+ * @return Placer::PlacementContext*
+ */
+PlacementContext* PlacementContext::current()
+{
+    static PlacementContext default_context;
+
+    return (p_current != nullptr) ? p_current : &default_context;
+}
+
+/**
+ * @brief Make a Context current on the calling Thread
+ *
+ * @param context Context of the Run
+ */
+PlacementContext::Scope::Scope(PlacementContext* context):
+    m_previous(p_current)
+{
+    nullpointer_check (context);
+
+    p_current = context;
+}
+
+/**
+ * @brief Restore the previous Context
+ */
+PlacementContext::Scope::~Scope()
+{
+    p_current = m_previous;
+}
@@ -0,0 +1,149 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : placement_context.hpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : State of a single Placement Run
+//==================================================================
+#ifndef PLACEMENT_CONTEXT_HPP
+#define PLACEMENT_CONTEXT_HPP
+
+#include <object.hpp>
+
+#include <vector>
+#include <string>
+#include <atomic>
+#include <mutex>
+
+#include <z3++.h>
+
+namespace Placer {
+
+/**
+ * @class PlacementContext
+ *
+ * @brief Everything a placement run used to keep in process wide statics:
+ *        configuration, Z3 context, key counter and result paths.
+ *        Every Object binds to the context current on its thread when it
+ *        is constructed, singletons such as the Logger keep one instance
+ *        per context. Runs following each other, e.g. a forked batch job,
+ *        therefore start from scratch in a fresh context.
+ *
+ * Not covered, so two contexts must not run on threads at the same time:
+ *   - the LEF/DEF parsers keep file-static pointers and the Si2 readers
+ *     global session state,
+ *   - config_z3 sets process wide Z3 parameters like smt.threads and
+ *     parallel.enable,
+ *   - the working directory, changed to the results and SMT directories
+ *     and for the shell backends (OptiMathSat, Parquet).
+ */
+class PlacementContext {
+public:
+    /**
+     * @class Scope
+     *
+     * @brief Makes a context current on the calling thread until the
+     *        Scope is left, the previous context is restored afterwards.
+     */
+    class Scope {
+    public:
+        explicit Scope(PlacementContext* context);
+
+        virtual ~Scope();
+
+    private:
+        PlacementContext* m_previous;
+    };
+
+    PlacementContext();
+
+    virtual ~PlacementContext();
+
+    static PlacementContext* current();
+
+private:
+    friend class Object;
+
+    PlacementContext(PlacementContext const &) = delete;
+    PlacementContext& operator=(PlacementContext const &) = delete;
+
+    static thread_local PlacementContext* p_current;
+
+    z3::context m_z3_ctx;
+    std::mutex m_z3_mutex;
+    std::atomic<size_t> m_key_counter;
+
+    std::vector<std::string> m_lef;
+    std::string m_def;
+    std::string m_site;
+    std::string m_supplement;
+    std::string m_base_path;
+    std::string m_working_directory;
+    std::string m_results_directory;
+    std::string m_image_directory;
+    std::string m_smt_directory;
+    std::string m_parquet_directory;
+    std::string m_floorplan_cache;
+    std::string m_snapshot_cache;
+    std::string m_lef_cache;
+    std::string m_log_name;
+    std::string m_bookshelf_file;
+    std::string m_bookshelf_export;
+    std::string m_design_name;
+    std::string m_binary_name;
+    std::string m_database_file;
+    std::string m_ini_file;
+    std::string m_hl_backend_ip;
+    eSolverBackend m_solver_backend;
+    size_t m_hl_backend_port;
+    size_t m_timeout;
+    size_t m_bitwidth_orientation;
+    size_t m_partition_id;
+    bool m_verbose;
+    bool m_log;
+    bool m_min_die_mode;
+    bool m_min_hpwl_mode;
+    bool m_smt_to_filesystem;
+    bool m_save_all;
+    bool m_save_best;
+    bool m_dump_all;
+    bool m_dump_best;
+    bool m_store_smt;
+    bool m_store_db;
+    bool m_pareto_optimizer;
+    bool m_lex_optimizer;
+    bool m_parquet_fp;
+    bool m_partitioning;
+    bool m_free_terminals;
+    bool m_free_components;
+    bool m_strip_terminals;
+    bool m_skip_power_network;
+    bool m_z3_api_mode;
+    bool m_z3_shell_mode;
+    bool m_symmetry_breaking;
+    bool m_incremental;
+    bool m_portfolio;
+    bool m_hierarchical;
+    bool m_bbox_hpwl;
+    bool m_skip_cells;
+    bool m_async_db;
+    bool m_export_results;
+    size_t m_leaf_size;
+    size_t m_partition_size;
+    size_t m_solver_workers;
+    size_t m_num_partitions;
+    size_t m_solutions;
+    size_t m_results_id;
+    size_t m_def_units;
+    size_t m_lef_units;
+    eLogic m_logic;
+    z3::expr_vector m_stored_constraints;
+};
+
+} /* namespace Placer */
+
+#endif /* PLACEMENT_CONTEXT_HPP */
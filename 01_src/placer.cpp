@@ -21,7 +21,20 @@ using namespace Placer::Utils;
  * @param argv Command Line Arguments Value
  */
 MacroPlacer::MacroPlacer(int const argc, char ** argv):
+    MacroPlacer(argc, argv, std::vector<std::string>())
+{
+}
+
+/**
+ * @brief Constructor for a Batch Job
+ *
+ * @param argc Command Line Arguments Counter
+ * @param argv Command Line Arguments Value
+ * @param overrides Ini File Lines (key=value) taking Priority over the Ini File
+ */
+MacroPlacer::MacroPlacer(int const argc, char ** argv, std::vector<std::string> const & overrides):
     Object(),
+    m_overrides(overrides),
     m_header_width(0)
 {
     nullpointer_check (argv);
@@ -35,11 +48,17 @@ MacroPlacer::MacroPlacer(int const argc, char ** argv):
  */
 MacroPlacer::~MacroPlacer()
 {
+    // Singletons are released for the context of this run only
+    PlacementContext::Scope scope(this->get_context());
+
     Utils::Logger::destroy();
 
     delete m_options_functions; m_options_functions = nullptr;
     delete m_timer; m_timer = nullptr;
     delete m_mckt; m_mckt = nullptr;
+
+    SolutionStore::destroy();
+    Geometry::destroy();
 }
 
 /**
@@ -62,6 +81,8 @@ void MacroPlacer::read_configuration()
             (CMD_DUMP_ALL,        CMD_DUMP_ALL_TEXT)
             (CMD_SAVE_ALL,        CMD_SAVE_ALL_TEXT)
             (CMD_STORE_DB,        CMD_STORE_DB_TEXT)
+            (CMD_ASYNC_DB,        CMD_ASYNC_DB_TEXT)
+            (CMD_EXPORT_RESULTS,  CMD_EXPORT_RESULTS_TEXT)
             (CMD_VERBOSE,         CMD_VERBOSE_TEXT)
             (CMD_STORE_LOG,       CMD_STORE_LOG_TEXT)
             (CMD_STORE_SMT,       CMD_STORE_SMT_TEXT)
@@ -69,29 +90,43 @@ void MacroPlacer::read_configuration()
             (CMD_LEX,             CMD_LEX_TEXT)
             (CMD_PARQUET,         CMD_PARQUET_TEXT)
             (CMD_PARTITION,       CMD_PARTITION_TEXT)
+            (CMD_HIERARCHICAL,    CMD_HIERARCHICAL_TEXT)
             (CMD_MIN_AREA,        CMD_MIN_AREA_TEXT)
             (CMD_MIN_HPWL,        CMD_MIN_HPWL_TEXT)
+            (CMD_BBOX_HPWL,       CMD_BBOX_HPWL_TEXT)
             (CMD_FREE_TERMINALS,  CMD_FREE_TERMINALS_TEXT)
             (CMD_FREE_COMPONENTS, CMD_FREE_COMPONENTS_TEXT)
             (CMD_SKIP_PWR_SUPPLY, CMD_SKIP_PWR_SUPPLY_TEXT)
+            (CMD_SKIP_CELLS,      CMD_SKIP_CELLS_TEXT)
+            (CMD_SYMMETRY_BREAKING, CMD_SYMMETRY_BREAKING_TEXT)
+            (CMD_INCREMENTAL,     CMD_INCREMENTAL_TEXT)
+            (CMD_PORTFOLIO,       CMD_PORTFOLIO_TEXT)
             (CMD_Z3_SHELL,        po::value<bool>()->default_value(true),                CMD_Z3_SHELL_TEXT)
             (CMD_Z3_API  ,        po::value<bool>()->default_value(false),               CMD_Z3_API_TEXT)
+            (CMD_SOLVER_WORKERS,  po::value<size_t>()->default_value(3),                 CMD_SOLVER_WORKERS_TEXT)
             (CMD_PARTITION_SIZE,  po::value<size_t>(),                                   CMD_PARTITION_SIZE_TEXT)
             (CMD_PARTITION_COUNT, po::value<size_t>(),                                   CMD_PARTITION_COUNT_TEXT)
+            (CMD_LEAF_SIZE,       po::value<size_t>()->default_value(8),                 CMD_LEAF_SIZE_TEXT)
             (CMD_DEF,             po::value<std::string>(),                              CMD_DEF_TEXT)
             (CMD_LEF,             po::value<std::string>(),                              CMD_LEF_TEXT)
             (CMD_BOOKSHELF,       po::value<std::string>(),                              CMD_BOOKSHELF_TEXT)
             (CMD_SUPPLEMENT,      po::value<std::string>(),                              CMD_SUPPLEMENT_TEXT)
+            (CMD_FLOORPLAN_CACHE, po::value<std::string>(),                              CMD_FLOORPLAN_CACHE_TEXT)
+            (CMD_SNAPSHOT_CACHE,  po::value<std::string>(),                              CMD_SNAPSHOT_CACHE_TEXT)
+            (CMD_LEF_CACHE,       po::value<std::string>(),                              CMD_LEF_CACHE_TEXT)
             (CMD_SITE,            po::value<std::string>(),                              CMD_SITE_TEXT)
             (CMD_SOLVER_BACKEND,  po::value<std::string>()->default_value("z3"),         CMD_SOLVER_BACKEND_TEXT)
             (CMD_HL_IP,           po::value<std::string>()->default_value("127.0.0.1"),  CMD_HL_IP_TEXT)
             (CMD_HL_PORT,         po::value<size_t>()->default_value(1111),              CMD_HL_PORT_TEXT)
             (CMD_TIMEOUT,         po::value<size_t>()->default_value(60),                CMD_TIMEOUT_TEXT)
             (CMD_SOLUTIONS,       po::value<size_t>()->default_value(1),                 CMD_SOLUTIONS_TEXT)
-            (CMD_INI_FILE,        po::value<std::string>()->default_value("config.ini"), CMD_INI_FILE_TEXT);
+            (CMD_INI_FILE,        po::value<std::string>()->default_value("config.ini"), CMD_INI_FILE_TEXT)
+            (CMD_BATCH,           po::value<std::string>(),                              CMD_BATCH_TEXT)
+            (CMD_BATCH_WORKERS,   po::value<size_t>()->default_value(1),                 CMD_BATCH_WORKERS_TEXT);
 
         // Top Level Priority: Command Line
-        // Second Level Priority: Local Ini File
+        // Second Level Priority: Batch Job Overrides
+        // Third Level Priority: Local Ini File
         // Commandline Overwrites Config File Arguments
         po::command_line_parser parser(m_argc, m_argv);
         parser.options(*m_options_functions).style(
@@ -104,6 +139,17 @@ void MacroPlacer::read_configuration()
         po::notify(m_vm);
         this->handle_configuration();
 
+        if (!m_overrides.empty()){
+            std::stringstream overrides;
+            for (std::string const & itor: m_overrides){
+                overrides << itor << std::endl;
+            }
+            po::store(po::parse_config_file(overrides, *m_options_functions), m_vm);
+
+            po::notify(m_vm);
+            this->handle_configuration();
+        }
+
         std::ifstream project_ini(this->get_ini_file());
         po::store(po::parse_config_file(project_ini, *m_options_functions), m_vm);
         project_ini.close();
@@ -147,23 +193,44 @@ void MacroPlacer::read_configuration()
             delete m_options_functions; m_options_functions = nullptr;
             throw std::runtime_error("Only one Z3 mode shall be activated at one time!");
         }
+        if (this->get_portfolio() && !this->get_z3_shell_mode()){
+            delete m_options_functions; m_options_functions = nullptr;
+            throw std::runtime_error("Portfolio solving requires the Z3 Backend Pool (z3-shell)!");
+        }
+        if (this->get_incremental() && !this->get_z3_api_mode()){
+            delete m_options_functions; m_options_functions = nullptr;
+            throw std::runtime_error("Incremental solving requires the Z3 API mode!");
+        }
+        if (this->get_hierarchical() && !this->get_partitioning()){
+            delete m_options_functions; m_options_functions = nullptr;
+            throw std::runtime_error("Hierarchical placement requires the Partitioning Mode!");
+        }
+        if (this->get_hierarchical() && this->get_leaf_size() == 0){
+            delete m_options_functions; m_options_functions = nullptr;
+            throw std::runtime_error("Leaf Size must be at least one Macro!");
+        }
 
         this->set_logic(eInt);
         this->set_base_path(Utils::Utils::get_base_path());
         this->set_working_directory(fs::current_path().string());
         this->set_results_directory("results");
-        this->set_results_id(this->existing_results() + 1);
+
+        // Batch jobs of the same design race for the next ID, only the
+        // job creating the directory owns it
+        size_t results_id = this->existing_results() + 1;
+        fs::create_directories(this->get_results_directory());
+        while (!fs::create_directory(this->get_results_directory() + "/" + std::to_string(results_id))){
+            results_id++;
+        }
+        this->set_results_id(results_id);
         this->set_image_directory("images");
         this->set_smt_directory("smt");
         this->set_parquet_directory("parquet");
         this->set_log_name("placer.log");
         this->set_database_file("results.db");
-        this->set_db_to_csv_script(this->get_base_path() + "/04_configuration/db_to_csv.sh");
         this->set_hl_backend_ip("140.78.161.14");
         this->set_hl_backend_port(1111);
 
-        fs::create_directories(this->get_results_directory() + "/" + std::to_string(this->get_results_id()));
-
         // Create Logger Singleton once the Commandline Information is known!
         m_logger = Utils::Logger::getInstance();
         m_timer  = new Placer::Utils::Timer();
@@ -227,6 +294,12 @@ void MacroPlacer::handle_configuration()
     if(m_vm.count(CMD_STORE_DB)){
         this->set_store_to_db(true);
     }
+    if(m_vm.count(CMD_ASYNC_DB)){
+        this->set_async_db(true);
+    }
+    if(m_vm.count(CMD_EXPORT_RESULTS)){
+        this->set_export_results(true);
+    }
     if(m_vm.count(CMD_TIMEOUT)){
         this->set_timeout(m_vm[CMD_TIMEOUT].as<size_t>());
     }
@@ -245,6 +318,21 @@ void MacroPlacer::handle_configuration()
     if(m_vm.count(CMD_PARTITION)){
         this->set_partitioning(true);
     }
+    if(m_vm.count(CMD_HIERARCHICAL)){
+        this->set_hierarchical(true);
+    }
+    if(m_vm.count(CMD_LEAF_SIZE)){
+        this->set_leaf_size(m_vm[CMD_LEAF_SIZE].as<size_t>());
+    }
+    if(m_vm.count(CMD_FLOORPLAN_CACHE)){
+        this->set_floorplan_cache(m_vm[CMD_FLOORPLAN_CACHE].as<std::string>());
+    }
+    if(m_vm.count(CMD_SNAPSHOT_CACHE)){
+        this->set_snapshot_cache(m_vm[CMD_SNAPSHOT_CACHE].as<std::string>());
+    }
+    if(m_vm.count(CMD_LEF_CACHE)){
+        this->set_lef_cache(m_vm[CMD_LEF_CACHE].as<std::string>());
+    }
     if(m_vm.count(CMD_PARQUET)){
         this->set_parquet_fp(true);
     }
@@ -260,6 +348,9 @@ void MacroPlacer::handle_configuration()
     if (m_vm.count(CMD_MIN_HPWL)){
         this->set_minimize_hpwl_mode(true);
     }
+    if (m_vm.count(CMD_BBOX_HPWL)){
+        this->set_bbox_hpwl(true);
+    }
     if(m_vm.count(CMD_FREE_TERMINALS)){
         this->set_free_terminals(true);
     }
@@ -269,6 +360,15 @@ void MacroPlacer::handle_configuration()
     if (m_vm.count(CMD_SKIP_PWR_SUPPLY)){
         this->set_skip_power_network(true);
     }
+    if (m_vm.count(CMD_SKIP_CELLS)){
+        this->set_skip_cells(true);
+    }
+    if (m_vm.count(CMD_SYMMETRY_BREAKING)){
+        this->set_symmetry_breaking(true);
+    }
+    if (m_vm.count(CMD_INCREMENTAL)){
+        this->set_incremental(true);
+    }
     if(m_vm.count(CMD_INI_FILE)){
         this->set_ini_file(m_vm[CMD_INI_FILE].as<std::string>());
     }
@@ -278,6 +378,12 @@ void MacroPlacer::handle_configuration()
     if (m_vm.count(CMD_Z3_SHELL)){
         this->set_z3_shell_mode(m_vm[CMD_Z3_SHELL].as<bool>());
     }
+    if (m_vm.count(CMD_PORTFOLIO)){
+        this->set_portfolio(true);
+    }
+    if (m_vm.count(CMD_SOLVER_WORKERS)){
+        this->set_solver_workers(m_vm[CMD_SOLVER_WORKERS].as<size_t>());
+    }
     if (m_vm.count(CMD_SOLVER_BACKEND)){
         std::string input = m_vm[CMD_SOLVER_BACKEND].as<std::string>();
         if (input == "z3"){
@@ -424,6 +530,9 @@ void MacroPlacer::post_process()
     if (this->get_store_to_db()){
         m_mckt->results_to_db();
     }
+    if (this->get_store_to_db() || this->get_export_results()){
+        m_mckt->export_results();
+    }
 
     this->print_footer();
 }
@@ -474,6 +583,8 @@ void MacroPlacer::store_configuration ()
     config << "solutions:" << this->get_max_solutions() << std::endl;
     config << "min_die_mode:" << this->get_minimize_die_mode() << std::endl;
     config << "min_hpwl_mode:" << this->get_minimize_hpwl_mode() << std::endl;
+    config << "symmetry_breaking:" << this->get_symmetry_breaking() << std::endl;
+    config << "incremental:" << this->get_incremental() << std::endl;
     config << "save_all:" << this->get_save_all() << std::endl;
     config << "save_best:" << this->get_save_best() << std::endl;
     config << "dump_all:" << this->get_dump_all() << std::endl;
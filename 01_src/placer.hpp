@@ -22,6 +22,7 @@
 #include <boost/filesystem.hpp>
 
 #include <object.hpp>
+#include <placement_context.hpp>
 #include <cmdline_arguments.hpp>
 #include <macrocircuit.hpp>
 #include <logger.hpp>
@@ -34,6 +35,7 @@ namespace Placer {
 class MacroPlacer: public virtual Object {
 public:
     MacroPlacer(int const argc, char ** argv);
+    MacroPlacer(int const argc, char ** argv, std::vector<std::string> const & overrides);
 
     virtual ~MacroPlacer();
 
@@ -46,6 +48,7 @@ public:
 private:
     int m_argc;
     char** m_argv;
+    std::vector<std::string> m_overrides;
 
     boost::program_options::options_description* m_options_functions;
     boost::program_options::variables_map m_vm;
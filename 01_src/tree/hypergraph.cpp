@@ -0,0 +1,301 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : hypergraph.cpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : Multi-Pin Net Container
+//==================================================================
+#include "hypergraph.hpp"
+#include "node.hpp"
+
+using namespace Placer;
+using namespace Placer::Utils;
+
+/**
+ * @brief Constructor
+ */
+Hypergraph::Hypergraph()
+{
+    m_net_start.push_back(0);
+    m_node_start.push_back(0);
+}
+
+/**
+ * @brief Destructor
+ */
+Hypergraph::~Hypergraph()
+{
+    /* Nodes are owned by the Tree */
+}
+
+/**
+ * @brief Get the ID of a Node, register it on first use
+ *
+ * @param node Tree Node
+ * @return size_t
+ */
+size_t Hypergraph::find_node(Node* node)
+{
+    auto find = m_node_ids.find(node);
+    if (find != m_node_ids.end()){
+        return find->second;
+    }
+    m_nodes.push_back(node);
+    m_node_ids[node] = m_nodes.size() - 1;
+
+    return m_nodes.size() - 1;
+}
+
+/**
+ * @brief Open a new Net, pins are added to the last opened net
+ *
+ * @param name Net Name
+ * @param weight Net Weight
+ * @return size_t Net ID
+ */
+size_t Hypergraph::add_net(std::string const & name,
+                           size_t const weight)
+{
+    m_net_names.push_back(name);
+    m_net_weights.push_back(weight);
+    m_net_start.push_back(m_pin_node.size());
+
+    return m_net_names.size() - 1;
+}
+
+/**
+ * @brief Add Pin to the last opened Net
+ *
+ * @param net Net ID
+ * @param node Node owning the Pin
+ * @param pin Pin Name
+ */
+void Hypergraph::add_pin(size_t const net,
+                         Node* node,
+                         std::string const & pin)
+{
+    nullpointer_check (node);
+    assertion_check (net + 1 == m_net_names.size());
+
+    m_pin_node.push_back(this->find_node(node));
+    m_pin_names.push_back(pin);
+    m_net_start.back() = m_pin_node.size();
+}
+
+/**
+ * @brief Build the Node to Net Adjacency
+ */
+void Hypergraph::finalize()
+{
+    std::vector<size_t> count(m_nodes.size(), 0);
+    for (size_t net = 0; net < this->get_num_nets(); ++net){
+        for (size_t i = this->get_net_begin(net); i < this->get_net_end(net); ++i){
+            count[m_pin_node[i]]++;
+        }
+    }
+
+    m_node_start.assign(m_nodes.size() + 1, 0);
+    for (size_t i = 0; i < m_nodes.size(); ++i){
+        m_node_start[i + 1] = m_node_start[i] + count[i];
+    }
+
+    std::vector<size_t> fill(m_node_start.begin(), m_node_start.end() - 1);
+    m_node_nets.assign(m_node_start.back(), 0);
+    for (size_t net = 0; net < this->get_num_nets(); ++net){
+        for (size_t i = this->get_net_begin(net); i < this->get_net_end(net); ++i){
+            m_node_nets[fill[m_pin_node[i]]++] = net;
+        }
+    }
+}
+
+/**
+ * @brief Remove all Terminal Pins, Nets are kept
+ */
+void Hypergraph::strip_terminals()
+{
+    std::vector<size_t> net_start(1, 0);
+    std::vector<size_t> pin_node;
+    std::vector<std::string> pin_names;
+
+    for (size_t net = 0; net < this->get_num_nets(); ++net){
+        for (size_t i = this->get_net_begin(net); i < this->get_net_end(net); ++i){
+            if (!m_nodes[m_pin_node[i]]->is_terminal()){
+                pin_node.push_back(m_pin_node[i]);
+                pin_names.push_back(m_pin_names[i]);
+            }
+        }
+        net_start.push_back(pin_node.size());
+    }
+
+    m_net_start.swap(net_start);
+    m_pin_node.swap(pin_node);
+    m_pin_names.swap(pin_names);
+
+    this->finalize();
+}
+
+/**
+ * @brief Get Number of Nets
+ *
+ * @return size_t
+ */
+size_t Hypergraph::get_num_nets() const
+{
+    return m_net_names.size();
+}
+
+/**
+ * @brief Get Number of Pins over all Nets
+ *
+ * @return size_t
+ */
+size_t Hypergraph::get_num_pins() const
+{
+    return m_pin_node.size();
+}
+
+/**
+ * @brief Get Number of Nodes
+ *
+ * @return size_t
+ */
+size_t Hypergraph::get_num_nodes() const
+{
+    return m_nodes.size();
+}
+
+/**
+ * @brief Get Net Name
+ *
+ * @param net Net ID
+ * @return std::string const&
+ */
+std::string const & Hypergraph::get_net_name(size_t const net) const
+{
+    return m_net_names[net];
+}
+
+/**
+ * @brief Get Index of the first Pin of a Net
+ *
+ * @param net Net ID
+ * @return size_t
+ */
+size_t Hypergraph::get_net_begin(size_t const net) const
+{
+    return m_net_start[net];
+}
+
+/**
+ * @brief Get Index behind the last Pin of a Net
+ *
+ * @param net Net ID
+ * @return size_t
+ */
+size_t Hypergraph::get_net_end(size_t const net) const
+{
+    return m_net_start[net + 1];
+}
+
+/**
+ * @brief Get Number of Pins of a Net
+ *
+ * @param net Net ID
+ * @return size_t
+ */
+size_t Hypergraph::get_net_degree(size_t const net) const
+{
+    return m_net_start[net + 1] - m_net_start[net];
+}
+
+/**
+ * @brief Get Net Weight
+ *
+ * @param net Net ID
+ * @return size_t
+ */
+size_t Hypergraph::get_net_weight(size_t const net) const
+{
+    return m_net_weights[net];
+}
+
+/**
+ * @brief Set Net Weight
+ *
+ * @param net Net ID
+ * @param weight Net Weight
+ */
+void Hypergraph::set_net_weight(size_t const net, size_t const weight)
+{
+    m_net_weights[net] = weight;
+}
+
+/**
+ * @brief Get the Node ID of a Pin
+ *
+ * @param pin Pin Index
+ * @return size_t
+ */
+size_t Hypergraph::get_pin_node(size_t const pin) const
+{
+    return m_pin_node[pin];
+}
+
+/**
+ * @brief Get the Name of a Pin
+ *
+ * @param pin Pin Index
+ * @return std::string const&
+ */
+std::string const & Hypergraph::get_pin_name(size_t const pin) const
+{
+    return m_pin_names[pin];
+}
+
+/**
+ * @brief Get Node by its ID
+ *
+ * @param node Node ID
+ * @return Placer::Node*
+ */
+Node* Hypergraph::get_node(size_t const node) const
+{
+    return m_nodes[node];
+}
+
+/**
+ * @brief Get Index of the first Net of a Node
+ *
+ * @param node Node ID
+ * @return size_t
+ */
+size_t Hypergraph::get_node_begin(size_t const node) const
+{
+    return m_node_start[node];
+}
+
+/**
+ * @brief Get Index behind the last Net of a Node
+ *
+ * @param node Node ID
+ * @return size_t
+ */
+size_t Hypergraph::get_node_end(size_t const node) const
+{
+    return m_node_start[node + 1];
+}
+
+/**
+ * @brief Get Net of the Node to Net Adjacency
+ *
+ * @param idx Index between get_node_begin and get_node_end
+ * @return size_t Net ID
+ */
+size_t Hypergraph::get_node_net(size_t const idx) const
+{
+    return m_node_nets[idx];
+}
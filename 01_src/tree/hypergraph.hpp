@@ -0,0 +1,84 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : hypergraph.hpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : Multi-Pin Net Container
+//==================================================================
+#ifndef HYPERGRAPH_HPP
+#define HYPERGRAPH_HPP
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+
+#include <exception.hpp>
+
+namespace Placer {
+
+class Node;
+
+/**
+ * @class Hypergraph
+ *
+ * @brief Nets with all their pins, nets and nodes are addressed by
+ *        integer IDs. The pins of a net are contiguous, the nets of a
+ *        node are available after finalize as compressed rows.
+ */
+class Hypergraph {
+public:
+    Hypergraph();
+
+    virtual ~Hypergraph();
+
+    size_t add_net(std::string const & name,
+                   size_t const weight = 1);
+    void add_pin(size_t const net,
+                 Node* node,
+                 std::string const & pin);
+
+    void finalize();
+    void strip_terminals();
+
+    size_t get_num_nets() const;
+    size_t get_num_pins() const;
+    size_t get_num_nodes() const;
+
+    std::string const & get_net_name(size_t const net) const;
+    size_t get_net_begin(size_t const net) const;
+    size_t get_net_end(size_t const net) const;
+    size_t get_net_degree(size_t const net) const;
+    size_t get_net_weight(size_t const net) const;
+    void set_net_weight(size_t const net, size_t const weight);
+
+    size_t get_pin_node(size_t const pin) const;
+    std::string const & get_pin_name(size_t const pin) const;
+
+    Node* get_node(size_t const node) const;
+    size_t get_node_begin(size_t const node) const;
+    size_t get_node_end(size_t const node) const;
+    size_t get_node_net(size_t const idx) const;
+
+private:
+    std::vector<std::string> m_net_names;
+    std::vector<size_t> m_net_start;
+    std::vector<size_t> m_net_weights;
+
+    std::vector<size_t> m_pin_node;
+    std::vector<std::string> m_pin_names;
+
+    std::vector<Node*> m_nodes;
+    std::unordered_map<Node*, size_t> m_node_ids;
+    std::vector<size_t> m_node_start;
+    std::vector<size_t> m_node_nets;
+
+    size_t find_node(Node* node);
+};
+
+} /* namespace Placer */
+
+#endif /* HYPERGRAPH_HPP */
@@ -179,6 +179,18 @@ void Node::insert_edge(Edge* _edge)
     m_edges.insert(_edge);
 }
 
+/**
+ * @brief Remove Edge from Node
+ * 
+ * @param _edge Edge to Remove
+ */
+void Node::remove_edge(Edge* _edge)
+{
+    nullpointer_check (_edge);
+
+    m_edges.erase(_edge);
+}
+
 /**
  * @brief Dump Node Information
  * 
@@ -55,6 +55,7 @@ public:
     size_t get_key();
 
     void insert_edge(Edge* _edge);
+    void remove_edge(Edge* _edge);
     std::set<Edge*> get_edges();
 
     void dump(std::ostream & stream = std::cout);
@@ -0,0 +1,201 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : symbol_table.cpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : Interned Names of Macros, Cells and Terminals
+//==================================================================
+#include "symbol_table.hpp"
+#include <components.hpp>
+
+using namespace Placer;
+using namespace Placer::Utils;
+
+/**
+ * @brief Constructor
+ */
+SymbolTable::SymbolTable()
+{
+}
+
+/**
+ * @brief Destructor
+ */
+SymbolTable::~SymbolTable()
+{
+    /* Components are owned by the MacroCircuit */
+}
+
+/**
+ * @brief Get the ID of a Name, register it on first use
+ *
+ * @param name Name to intern
+ * @return size_t
+ */
+size_t SymbolTable::intern(std::string const & name)
+{
+    auto find = m_ids.find(name);
+    if (find != m_ids.end()){
+        return find->second;
+    }
+
+    auto insert = m_ids.emplace(name, m_names.size()).first;
+    // Keys of an unordered_map are stable across rehashing
+    m_names.push_back(&insert->first);
+    m_macros.push_back(nullptr);
+    m_cells.push_back(nullptr);
+    m_terminals.push_back(nullptr);
+    m_cell_records.push_back(-1);
+
+    return insert->second;
+}
+
+/**
+ * @brief Get the ID of a Name without registering it
+ *
+ * @param name Name to search
+ * @return long ID, -1 if the Name is unknown
+ */
+long SymbolTable::find(std::string const & name) const
+{
+    auto find = m_ids.find(name);
+    if (find == m_ids.end()){
+        return -1;
+    }
+
+    return find->second;
+}
+
+/**
+ * @brief Get the Name of an ID
+ *
+ * @param id Symbol ID
+ * @return std::string const&
+ */
+std::string const & SymbolTable::get_name(size_t const id) const
+{
+    assertion_check (id < m_names.size());
+
+    return *m_names[id];
+}
+
+/**
+ * @brief Get Number of interned Names
+ *
+ * @return size_t
+ */
+size_t SymbolTable::size() const
+{
+    return m_names.size();
+}
+
+/**
+ * @brief Register a Macro by its ID
+ *
+ * @param macro Macro
+ */
+void SymbolTable::add_macro(Macro* macro)
+{
+    nullpointer_check (macro);
+
+    m_macros[this->intern(macro->get_id())] = macro;
+}
+
+/**
+ * @brief Register a Cell by its ID
+ *
+ * @param cell Cell
+ */
+void SymbolTable::add_cell(Cell* cell)
+{
+    nullpointer_check (cell);
+
+    m_cells[this->intern(cell->get_id())] = cell;
+}
+
+/**
+ * @brief Register a Terminal by its Name
+ *
+ * @param terminal Terminal
+ */
+void SymbolTable::add_terminal(Terminal* terminal)
+{
+    nullpointer_check (terminal);
+
+    m_terminals[this->intern(terminal->get_name())] = terminal;
+}
+
+/**
+ * @brief Register a Cell Record by the ID of its Cell
+ *
+ * @param id Cell ID
+ * @param record Index of the Record
+ */
+void SymbolTable::add_cell_record(std::string const & id, size_t const record)
+{
+    m_cell_records[this->intern(id)] = record;
+}
+
+/**
+ * @brief Forget all registered Terminals, their Names stay interned
+ */
+void SymbolTable::remove_terminals()
+{
+    std::fill(m_terminals.begin(), m_terminals.end(), nullptr);
+}
+
+/**
+ * @brief Search Macro by its ID
+ *
+ * @param name Macro ID
+ * @return Placer::Macro* nullptr if not registered
+ */
+Macro* SymbolTable::find_macro(std::string const & name) const
+{
+    long id = this->find(name);
+
+    return (id < 0) ? nullptr : m_macros[id];
+}
+
+/**
+ * @brief Search Cell by its ID
+ *
+ * @param name Cell ID
+ * @return Placer::Cell* nullptr if not registered
+ */
+Cell* SymbolTable::find_cell(std::string const & name) const
+{
+    long id = this->find(name);
+
+    return (id < 0) ? nullptr : m_cells[id];
+}
+
+/**
+ * @brief Search Terminal by its Name
+ *
+ * @param name Terminal Name
+ * @return Placer::Terminal* nullptr if not registered
+ */
+Terminal* SymbolTable::find_terminal(std::string const & name) const
+{
+    long id = this->find(name);
+
+    return (id < 0) ? nullptr : m_terminals[id];
+}
+
+/**
+ * @brief Search Cell Record by the ID of its Cell
+ *
+ * @param name Cell ID
+ * @return long Record Index, -1 if not registered
+ */
+long SymbolTable::find_cell_record(std::string const & name) const
+{
+    long id = this->find(name);
+
+    return (id < 0) ? -1 : m_cell_records[id];
+}
@@ -0,0 +1,72 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : symbol_table.hpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : Interned Names of Macros, Cells and Terminals
+//==================================================================
+#ifndef SYMBOL_TABLE_HPP
+#define SYMBOL_TABLE_HPP
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <algorithm>
+
+#include <exception.hpp>
+
+namespace Placer {
+
+class Macro;
+class Cell;
+class Terminal;
+
+/**
+ * @class SymbolTable
+ *
+ * @brief Every name is interned once and mapped to a dense integer ID.
+ *        The components registered under a name are kept in arrays
+ *        indexed by that ID, so lookups by name are a single hash probe.
+ *        Macros and Cells share the instance namespace, Terminals have
+ *        their own slot since a pin may carry the name of an instance.
+ *        Cells without a Cell object are tracked by their record index.
+ */
+class SymbolTable {
+public:
+    SymbolTable();
+
+    virtual ~SymbolTable();
+
+    size_t intern(std::string const & name);
+    long find(std::string const & name) const;
+    std::string const & get_name(size_t const id) const;
+    size_t size() const;
+
+    void add_macro(Macro* macro);
+    void add_cell(Cell* cell);
+    void add_terminal(Terminal* terminal);
+    void add_cell_record(std::string const & id, size_t const record);
+    void remove_terminals();
+
+    Macro* find_macro(std::string const & name) const;
+    Cell* find_cell(std::string const & name) const;
+    Terminal* find_terminal(std::string const & name) const;
+    long find_cell_record(std::string const & name) const;
+
+private:
+    std::unordered_map<std::string, size_t> m_ids;
+    std::vector<std::string const *> m_names;
+
+    std::vector<Macro*> m_macros;
+    std::vector<Cell*> m_cells;
+    std::vector<Terminal*> m_terminals;
+    std::vector<long> m_cell_records;
+};
+
+} /* namespace Placer */
+
+#endif /* SYMBOL_TABLE_HPP */
@@ -19,12 +19,15 @@ using namespace Placer::Utils;
 /**
  * @brief Constructor
  * 
- * @param ctx Z3 Context
+ * @param symbols Symbol Table shared with the Input Readers
  */
-Tree::Tree():
+Tree::Tree(SymbolTable* symbols):
     Object()
 {
+    nullpointer_check (symbols);
+
     m_logger = Utils::Logger::getInstance();
+    m_symbols = symbols;
 }
 
 /**
@@ -57,7 +60,11 @@ void Tree::destroy()
  * 
  * @param tree Tree to Copy
  */
-Tree::Tree(Tree const & tree)
+Tree::Tree(Tree const & tree):
+    m_hypergraph(tree.m_hypergraph),
+    m_symbols(tree.m_symbols),
+    m_component_nodes(tree.m_component_nodes),
+    m_terminal_nodes(tree.m_terminal_nodes)
 {
     // Copy Pointer --> Shallow Copy
     std::copy(tree.m_edges.begin(), tree.m_edges.end(), std::back_inserter(m_edges));
@@ -99,40 +106,18 @@ std::vector<Edge *> Tree::get_edges()
 }
 
 /**
- * @brief Find Node by its ID and Name
+ * @brief Find Node by its Symbol
  * 
- * @param name Node Name
- * @param id Node ID
- * @return Placer::Node*
+ * @param symbol Symbol ID of the Macro/Cell ID or Terminal Name
+ * @param terminal Search the Terminal Nodes
+ * @return Placer::Node* nullptr if no Node exists
  */
-Node* Tree::find_node(std::string const & name,
-                      std::string const & id)
+Node* Tree::find_node(size_t const symbol,
+                      bool const terminal)
 {
-    Node* retval = nullptr;
-
-    for(auto itor: m_nodes){
-        if(itor->get_macro() != nullptr){
-            if(itor->get_macro()->get_id() == id){
-                retval = itor;
-                break;
-            }
-        } else if (itor->get_cell() != nullptr){
-            if (itor->get_cell()->get_id() == id){
-                retval = itor;
-                break;
-            }
-        }
-    }
+    std::vector<Node*> const & index = terminal ? m_terminal_nodes : m_component_nodes;
 
-    if(!retval){
-        for(auto itor: m_terminals){
-            if(itor->get_terminal()->get_name() == id){
-                retval = itor;
-                break;
-            }
-        }
-    }
-    return retval;
+    return (symbol < index.size()) ? index[symbol] : nullptr;
 }
 
 /**
@@ -156,6 +141,25 @@ void Tree::dump(std::ostream& stream)
 void Tree::construct_tree()
 {
     try {
+        m_hypergraph.finalize();
+
+        // Star Edges from the first Pin of every Net
+        for (size_t net = 0; net < m_hypergraph.get_num_nets(); ++net){
+            size_t driver = m_hypergraph.get_net_begin(net);
+            Node* from = m_hypergraph.get_node(m_hypergraph.get_pin_node(driver));
+
+            for (size_t i = driver + 1; i < m_hypergraph.get_net_end(net); ++i){
+                Node* to = m_hypergraph.get_node(m_hypergraph.get_pin_node(i));
+
+                m_edges.push_back(new Edge(from,
+                                           to,
+                                           m_hypergraph.get_pin_name(driver),
+                                           m_hypergraph.get_pin_name(i),
+                                           m_hypergraph.get_net_name(net)));
+                m_logger->insert_edge(from->get_id(), to->get_id());
+            }
+        }
+
         m_logger->construct_tree(m_edges.size());
 
         for(auto edge: m_edges){
@@ -176,18 +180,28 @@ void Tree::construct_tree()
  * @brief Allocate new Element 
  * 
  * @param _node Node to Add
+ * @param symbol Symbol ID of the Node
  */
-void Tree::new_element(Node* _node)
+void Tree::new_element(Node* _node,
+                       size_t const symbol)
 {
     nullpointer_check (_node );
 
+    std::vector<Node*>* index = nullptr;
     if(_node->is_node()){
         m_nodes.push_back(_node);
+        index = &m_component_nodes;
     } else if (_node->is_terminal()){
         m_terminals.push_back(_node);
+        index = &m_terminal_nodes;
     } else {
         notimplemented_check();
     }
+
+    if (index->size() <= symbol){
+        index->resize(m_symbols->size(), nullptr);
+    }
+    (*index)[symbol] = _node;
 }
 
 /**
@@ -339,33 +353,36 @@ void Tree::show_png()
 }
 
 /**
- * @brief Reconstruct Steiner Tree
+ * @brief Open a new Net, Pins are added using insert_pin
  * 
- * @return std::map< std::string, std::set< std::string > >
+ * @param net_name Net Name
+ * @param weight Net Weight
+ * @return size_t Net ID
  */
-std::map<std::string, std::set<std::string> > Tree::get_steiner_tree()
+size_t Tree::insert_net(std::string const & net_name,
+                        size_t const weight)
 {
-    m_steiner_tree.clear();
-
-    for (Edge* edge: m_edges){
-        nullpointer_check(edge);
-        
-        Node* from = edge->get_from();
-        nullpointer_check(from);
-        
-        std::string from_id = from->get_id();
-        std::string from_pin = edge->get_from_pin();
+    return m_hypergraph.add_net(net_name, weight);
+}
 
-        Node* to = edge->get_to();
-        nullpointer_check(to);
-        std::string to_id = to->get_id();
-        std::string to_pin = edge->get_to_pin();
+/**
+ * @brief Get Access to the Multi-Pin Nets
+ * 
+ * @return Placer::Hypergraph&
+ */
+Hypergraph& Tree::get_hypergraph()
+{
+    return m_hypergraph;
+}
 
-        std::string id1 = from_id + ":" + from_pin;
-        std::string id2 = to_id + ":" + to_pin;
-        m_steiner_tree[id1].insert(id2);
-    }
-    return m_steiner_tree;
+/**
+ * @brief Get the Symbol Table used to index the Nodes
+ * 
+ * @return Placer::SymbolTable*
+ */
+SymbolTable* Tree::get_symbol_table()
+{
+    return m_symbols;
 }
 
 /**
@@ -380,51 +397,34 @@ void Tree::export_hypergraph()
                             "/" +
                             filename);
 
-    std::map<std::string, std::set<std::string>> steiner_tree = this->get_steiner_tree();
+    size_t num_nets = 0;
+    for (size_t net = 0; net < m_hypergraph.get_num_nets(); ++net){
+        if (m_hypergraph.get_net_degree(net) > 1){
+            num_nets++;
+        }
+    }
 
     // Header: Edges Nodes Settings
     // Settings 0  Unweigthed Hypergraph
     //          1  Hypergraph with edge weights
     //          10 Hypergraph with node weights
     //          11 Hypergraph with node and edge weights
-    hgr_file << m_steiner_tree.size() << " " << m_nodes.size() + m_terminals.size() << std::endl;
-    for (auto edge: steiner_tree){
-        std::vector<std::string> root_token = Utils::Utils::tokenize(edge.first, ":");
-        Node* root = this->find_node(root_token[0], root_token[0]);
-        nullpointer_check(root);
-        size_t root_key = 0;
-        if (root->is_node()){
-            Macro* m = root->get_macro();
-            root_key = m->get_key();
-        } else {
-            Terminal* t = root->get_terminal();
-            root_key = t->get_key();
+    hgr_file << num_nets << " " << m_nodes.size() + m_terminals.size() << std::endl;
+    for (size_t net = 0; net < m_hypergraph.get_num_nets(); ++net){
+        if (m_hypergraph.get_net_degree(net) < 2){
+            continue;
         }
 
-        hgr_file << root_key << " ";
-
-        std::set<size_t> sub_keys;
-        for (auto itor2: edge.second){
-            std::vector<std::string> token = Utils::Utils::tokenize(itor2, ":");
-            Node* node = this->find_node(token[0], token[0]);
+        // Unique Keys, no Edge can point at itself
+        std::vector<size_t> keys;
+        for (size_t i = m_hypergraph.get_net_begin(net); i < m_hypergraph.get_net_end(net); ++i){
+            Node* node = m_hypergraph.get_node(m_hypergraph.get_pin_node(i));
             nullpointer_check(node);
 
-            size_t sub_key = 0;
-            if (node->is_node()){
-                Macro* sub_m = node->get_macro();
-                sub_key = sub_m->get_key();
-            } else {
-                Terminal* t = node->get_terminal();
-                sub_key = t->get_key();
-            }
-            // No Edge can point at itself
-            // Use a set to get unique subkeys
-            sub_keys.insert(sub_key);
-        }
-
-        for (auto itor2: sub_keys){
-            if (itor2 != root_key){
-                hgr_file << itor2 << " ";
+            size_t key = node->get_key();
+            if (std::find(keys.begin(), keys.end(), key) == keys.end()){
+                keys.push_back(key);
+                hgr_file << key << " ";
             }
         }
         hgr_file << std::endl;
@@ -468,9 +468,11 @@ void Tree::strip_terminals()
         }
     }
     m_terminals.clear();
+    m_terminal_nodes.clear();
     m_edges.clear();
 
     std::copy(next_edges.begin(), next_edges.end(), std::back_inserter(m_edges));
+    m_hypergraph.strip_terminals();
 }
 
 void Tree::analyze_tree()
@@ -483,39 +485,41 @@ void Tree::analyze_tree()
     }
 }
 
+/**
+ * @brief Merge parallel Edges and accumulate their Weights
+ * 
+ * Edges are equal if they connect the same pins of the same nodes. The
+ * first edge of a key survives, later duplicates are folded into it.
+ */
 void Tree::merge_edges()
 {
-    for (size_t i = 0; i < m_edges.size(); ++i){
-        for (size_t j = 0; j < m_edges.size(); ++j){
-            if (i ==j){
-                continue;
-            }
-            Edge* a = m_edges[i];
-            Edge* b = m_edges[j];
-            
-            if (a == nullptr){
-                continue;
-            }
-            if (b == nullptr){
-                continue;
-            }
-            
-            if (*a == *b){
-                std::cout << "Merge " << a->get_from()->get_id() << " " << a->get_from_pin() << " " << b->get_from()->get_id() << " " <<  b->get_from_pin() << " "
-                                      << a->get_to()->get_id() << " " << a->get_to_pin() << " " << b->get_to()->get_id() << " " <<  b->get_to_pin() << std::endl;
-                a->set_weight(a->get_weight() + b->get_weight());
-                delete b; m_edges[j] = nullptr;
-            }
-        }
-    }
-    
+    typedef std::tuple<Node*, std::string, Node*, std::string> edge_key;
+
+    std::map<edge_key, Edge*> unique_edges;
     std::vector<Edge*> next_edges;
-    for (auto itor: m_edges){
-        if (itor){
-            next_edges.push_back(itor);
+    size_t merged = 0;
+
+    for (Edge* edge: m_edges){
+        nullpointer_check (edge);
+
+        edge_key key(edge->get_from(), edge->get_from_pin(),
+                     edge->get_to(), edge->get_to_pin());
+
+        auto insert = unique_edges.insert(std::make_pair(key, edge));
+        if (insert.second){
+            next_edges.push_back(edge);
+            continue;
         }
+
+        Edge* survivor = insert.first->second;
+        survivor->set_weight(survivor->get_weight() + edge->get_weight());
+
+        edge->get_from()->remove_edge(edge);
+        edge->get_to()->remove_edge(edge);
+        delete edge; edge = nullptr;
+        merged++;
     }
-    
-    m_edges.clear();
-    std::copy(next_edges.begin(), next_edges.end(), std::back_inserter(m_edges));
+
+    m_edges.swap(next_edges);
+    m_logger->merge_edges(merged, m_edges.size());
 }
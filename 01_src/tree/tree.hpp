@@ -18,11 +18,15 @@
 #include <iostream>
 #include <cstdlib>
 #include <sstream>
+#include <type_traits>
+#include <tuple>
 #include <z3++.h>
 
 #include <object.hpp>
 #include <node.hpp>
 #include <edge.hpp>
+#include <hypergraph.hpp>
+#include <symbol_table.hpp>
 #include <components.hpp>
 #include <logger.hpp>
 #include <exception.hpp>
@@ -35,7 +39,7 @@ class Edge;
 class Tree: public virtual Object {
 public:
 
-    Tree();
+    Tree(SymbolTable* symbols);
 
     virtual ~Tree();
 
@@ -46,12 +50,13 @@ public:
     bool operator== (Tree const & tree);
     Tree& operator= (Tree const & tree);
 
-    template<typename from,typename to>
-    void insert_edge(from* from_val,
-                     to* to_val,
-                     std::string const & from_pin,
-                     std::string const & to_pin,
-                     std::string const & edge_name);
+    size_t insert_net(std::string const & net_name,
+                      size_t const weight = 1);
+
+    template<typename T>
+    void insert_pin(size_t const net,
+                    T* val,
+                    std::string const & pin);
 
     void verify_edges();
 
@@ -67,7 +72,8 @@ public:
 
     void export_hypergraph();
 
-    std::map<std::string, std::set<std::string>> get_steiner_tree();
+    Hypergraph& get_hypergraph();
+    SymbolTable* get_symbol_table();
     
     void merge_edges();
     void analyze_tree();
@@ -78,11 +84,17 @@ private:
     std::vector<Node*> m_terminals;
     std::vector<Edge*> m_edges;
     std::vector<Node*> m_nodes;
-    std::map<std::string, std::set<std::string>> m_steiner_tree;
+    Hypergraph m_hypergraph;
+
+    // Nodes indexed by Symbol ID
+    SymbolTable* m_symbols;
+    std::vector<Node*> m_component_nodes;
+    std::vector<Node*> m_terminal_nodes;
 
-    Node* find_node(std::string const & name,
-                    std::string const & id);
-    void new_element(Node* _node);
+    Node* find_node(size_t const symbol,
+                    bool const terminal);
+    void new_element(Node* _node,
+                     size_t const symbol);
 
     void export_dot_file();
     void dot_to_png();
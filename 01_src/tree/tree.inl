@@ -15,36 +15,25 @@
 
 using namespace Placer;
 
-template<typename from,typename to>
-void Tree::insert_edge(from* from_val,
-                       to* to_val,
-                       std::string const & from_pin,
-                       std::string const & to_pin,
-                       std::string const & edge_name)
+template<typename T>
+void Tree::insert_pin(size_t const net,
+                      T* val,
+                      std::string const & pin)
 {
-    nullpointer_check (from_val);
-    nullpointer_check (to_val);
+    nullpointer_check (val);
 
-    Node* _from = this->find_node(from_val->get_name(), from_val->get_id());
-    Node* _to = this->find_node(to_val->get_name(), to_val->get_id());
+    // Terminals are named by their ID, Macros and Cells share a namespace
+    size_t symbol = m_symbols->intern(val->get_id());
+    Node* _node = this->find_node(symbol, std::is_same<T, Terminal>::value);
 
-    if(_from == nullptr){
-        _from = new Node(from_val);
-        this->new_element(_from);
-    }
-    
-    if(_to == nullptr){
-        _to = new Node(to_val);
-        this->new_element(_to);
+    if(_node == nullptr){
+        _node = new Node(val);
+        this->new_element(_node, symbol);
     }
 
-   if (this->get_minimize_die_mode()){
-        Edge* _edge = new Edge(_from, _to, "center", "center", edge_name);
-        m_edges.push_back(_edge);
+    if (this->get_minimize_die_mode()){
+        m_hypergraph.add_pin(net, _node, "center");
     } else {
-        Edge* _edge = new Edge(_from, _to, from_pin, to_pin, edge_name);
-        m_edges.push_back(_edge);
+        m_hypergraph.add_pin(net, _node, pin);
     }
-
-    m_logger->insert_edge(_from->get_id(), _to->get_id());
 }
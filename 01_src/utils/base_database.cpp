@@ -20,8 +20,10 @@ using namespace Placer::Utils;
  */
 BaseDatabase::BaseDatabase(std::string const & url)
 {
+    p_db = nullptr;
     p_db_url = url;
     p_debug = false;
+    p_transaction = false;
 }
 
 /**
@@ -40,7 +42,10 @@ BaseDatabase::~BaseDatabase()
  */
 void BaseDatabase::db_command(std::string const & command)
 {
-    this->open_database();
+    // Inside a transaction the connection stays open
+    if (!p_transaction){
+        this->open_database();
+    }
     p_debug && std::cout << Utils::Utils::get_bash_string_orange("db_command: " + command) << std::endl;
 
     char const * str = command.c_str();
@@ -48,7 +53,9 @@ void BaseDatabase::db_command(std::string const & command)
         std::cout << "here" << std::endl;
         throw std::runtime_error(std::string(sqlite3_errmsg(p_db)));
     }
-    this->close_database();
+    if (!p_transaction){
+        this->close_database();
+    }
 }
 
 /**
@@ -72,9 +79,139 @@ void BaseDatabase::close_database()
     p_debug && std::cout << "Close BaseDatabase has been called" << std::endl;
     if(p_db){
         sqlite3_close(p_db);
+        p_db = nullptr;
+    }
+}
+
+/**
+ * @brief Switch the Database File to Write-Ahead Logging
+ *
+ * The journal mode is persistent, commits no longer wait for a full sync.
+ */
+void BaseDatabase::set_write_ahead_log()
+{
+    this->db_command("PRAGMA journal_mode=WAL;");
+}
+
+/**
+ * @brief Open the Connection and start a Transaction
+ *
+ * The connection is kept open until the transaction is committed.
+ */
+void BaseDatabase::begin_transaction()
+{
+    assertion_check (!p_transaction);
+
+    this->open_database();
+    p_transaction = true;
+    this->db_command("PRAGMA synchronous=NORMAL;");
+    this->db_command("BEGIN TRANSACTION;");
+}
+
+/**
+ * @brief Commit the running Transaction and close the Connection
+ */
+void BaseDatabase::commit_transaction()
+{
+    assertion_check (p_transaction);
+
+    this->db_command("COMMIT;");
+    p_transaction = false;
+    this->close_database();
+}
+
+/**
+ * @brief Discard the running Transaction and close the Connection
+ */
+void BaseDatabase::rollback_transaction()
+{
+    assertion_check (p_transaction);
+
+    this->db_command("ROLLBACK;");
+    p_transaction = false;
+    this->close_database();
+}
+
+/**
+ * @brief Check if a Transaction is running
+ *
+ * @return bool
+ */
+bool BaseDatabase::in_transaction() const
+{
+    return p_transaction;
+}
+
+/**
+ * @brief Compile a Statement for the running Transaction
+ *
+ * @param query SQL Statement with ? Placeholders
+ * @return sqlite3_stmt*
+ */
+sqlite3_stmt* BaseDatabase::prepare(std::string const & query)
+{
+    assertion_check (p_transaction);
+
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(p_db, query.c_str(), -1, &stmt, nullptr) != SQLITE_OK){
+        throw std::runtime_error(std::string(sqlite3_errmsg(p_db)));
+    }
+
+    return stmt;
+}
+
+/**
+ * @brief Bind an Integer to a Placeholder
+ *
+ * @param stmt Prepared Statement
+ * @param idx Placeholder Index, starts at 1
+ * @param value Value
+ */
+void BaseDatabase::bind(sqlite3_stmt* stmt, int const idx, size_t const value)
+{
+    if (sqlite3_bind_int64(stmt, idx, static_cast<sqlite3_int64>(value)) != SQLITE_OK){
+        throw std::runtime_error(std::string(sqlite3_errmsg(p_db)));
     }
 }
 
+/**
+ * @brief Bind a Text to a Placeholder
+ *
+ * @param stmt Prepared Statement
+ * @param idx Placeholder Index, starts at 1
+ * @param value Value, copied by Sqlite
+ */
+void BaseDatabase::bind(sqlite3_stmt* stmt, int const idx, std::string const & value)
+{
+    if (sqlite3_bind_text(stmt, idx, value.c_str(), -1, SQLITE_TRANSIENT) != SQLITE_OK){
+        throw std::runtime_error(std::string(sqlite3_errmsg(p_db)));
+    }
+}
+
+/**
+ * @brief Run a bound Statement and reset it for the next Row
+ *
+ * @param stmt Prepared Statement
+ */
+void BaseDatabase::execute(sqlite3_stmt* stmt)
+{
+    if (sqlite3_step(stmt) != SQLITE_DONE){
+        throw std::runtime_error(std::string(sqlite3_errmsg(p_db)));
+    }
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+}
+
+/**
+ * @brief Release a Prepared Statement
+ *
+ * @param stmt Prepared Statement
+ */
+void BaseDatabase::finalize(sqlite3_stmt* stmt)
+{
+    sqlite3_finalize(stmt);
+}
+
 /**
  * @brief Static Callback function for the Sqlite3 API
  * This function calls a member function in order to get access to the
@@ -18,6 +18,7 @@
 #include <exception>
 
 #include <utils.hpp>
+#include <exception.hpp>
 
 namespace Placer::Utils {
 
@@ -41,9 +42,23 @@ protected:
     void open_database();
     void close_database();
 
+    void set_write_ahead_log();
+
+    void begin_transaction();
+    void commit_transaction();
+    void rollback_transaction();
+    bool in_transaction() const;
+
+    sqlite3_stmt* prepare(std::string const & query);
+    void bind(sqlite3_stmt* stmt, int const idx, size_t const value);
+    void bind(sqlite3_stmt* stmt, int const idx, std::string const & value);
+    void execute(sqlite3_stmt* stmt);
+    void finalize(sqlite3_stmt* stmt);
+
     sqlite3* p_db;
     std::string p_db_url;
     bool p_debug;
+    bool p_transaction;
 };
 
 } /* namespace Placer::Utils */
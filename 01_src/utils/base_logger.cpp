@@ -13,14 +13,14 @@
 
 using namespace Placer::Utils;
 
-LogStream* BaseLogger::p_log_stream = nullptr;
+std::mutex LogStream::p_output_mutex;
 
 /**
  * @brief Constructor
  */
-BaseLogger::BaseLogger()
+BaseLogger::BaseLogger():
+    p_log_stream(new LogStream())
 {
-    p_log_stream = new LogStream();
 }
 
 /**
@@ -34,11 +34,18 @@ BaseLogger::~BaseLogger()
 /**
  * @brief Logging Method
  * 
+ * The stream of the Logger only holds the configuration, every call works on
+ * its own copy so concurrent callers can not swap their log levels.
+ * 
  * @param level Log Leve to be used.
  * @return Forest::Utils::LogStream
  */
 LogStream BaseLogger::LOG(LogSeverity const & level)
 {
-    p_log_stream->set_log_level(level);
-    return *(BaseLogger::p_log_stream);
+    std::lock_guard<std::mutex> lock(p_log_mutex);
+
+    LogStream stream(*p_log_stream);
+    stream.set_log_level(level);
+
+    return stream;
 }
@@ -56,6 +56,7 @@ public:
     template<typename T>
     LogStream& operator<< (T const & val)
     {
+        std::lock_guard<std::mutex> lock(p_output_mutex);
         std::string level_id = this->log_level_to_string(p_severity_level);
 
         if(p_log_enabled) {
@@ -172,6 +173,8 @@ public:
     }
 
 private:
+    static std::mutex p_output_mutex;
+
     LogSeverity p_severity_level;
 
     bool p_log_enabled;
@@ -292,7 +295,8 @@ protected:
 
     virtual ~BaseLogger();
 
-    static LogStream* p_log_stream;
+    LogStream* p_log_stream;
+    std::mutex p_log_mutex;
     LogStream LOG(LogSeverity const & level);
 };
 
@@ -20,7 +20,14 @@ using namespace Placer::Utils;
  */
 Database::Database(std::string const & db_file):
     Object(),
-    BaseDatabase(db_file)
+    BaseDatabase(db_file),
+    m_insert_macro(nullptr),
+    m_insert_terminal(nullptr),
+    m_insert_pin(nullptr),
+    m_insert_layout(nullptr),
+    m_insert_results(nullptr),
+    m_async(false),
+    m_writer_done(false)
 {
     m_logger = Logger::getInstance();
 }
@@ -30,9 +37,42 @@ Database::Database(std::string const & db_file):
  */
 Database::~Database()
 {
+    this->stop_writer();
     m_logger = nullptr;
 }
 
+/**
+ * @brief Begin a Batch of Results
+ * 
+ * @param db Database to write to
+ */
+Database::ResultsBatch::ResultsBatch(Database & db):
+    m_db(db),
+    m_open(false)
+{
+    m_db.begin_results();
+    m_open = true;
+}
+
+/**
+ * @brief Roll back a Batch left by an Exception
+ */
+Database::ResultsBatch::~ResultsBatch()
+{
+    if (m_open){
+        m_db.abort_results();
+    }
+}
+
+/**
+ * @brief Write the remaining Rows and commit the Batch
+ */
+void Database::ResultsBatch::commit()
+{
+    m_db.end_results();
+    m_open = false;
+}
+
 /**
  * @brief Init Database and Create Tables
  */
@@ -84,6 +124,164 @@ void Database::init_database()
     stream << "area INTEGER,";
     stream << "hpwl INTEGER);";
     this->db_command(stream.str());
+
+    this->set_write_ahead_log();
+}
+
+/**
+ * @brief Start a Batch of Results
+ * 
+ * All rows until end_results are written in a single transaction with
+ * prepared statements. If enabled, a writer thread binds and steps the
+ * rows while the caller keeps collecting them.
+ */
+void Database::begin_results()
+{
+    this->begin_transaction();
+
+    try {
+        m_insert_macro    = this->prepare("INSERT INTO macros VALUES (?,?,?,?,?,?,?,?,?);");
+        m_insert_terminal = this->prepare("INSERT INTO terminals VALUES (?,?,?,?);");
+        m_insert_pin      = this->prepare("INSERT INTO pins VALUES (?,?,?,?,?);");
+        m_insert_layout   = this->prepare("INSERT INTO layout VALUES (?,?,?,?,?);");
+        m_insert_results  = this->prepare("INSERT INTO results VALUES (?,?,?);");
+    } catch (...) {
+        this->abort_results();
+        throw;
+    }
+
+    m_async = this->get_async_db();
+    m_writer_done = false;
+    m_writer_error = nullptr;
+    if (m_async){
+        m_writer = std::thread(&Database::writer_loop, this);
+    }
+}
+
+/**
+ * @brief Finish the Batch, wait for the Writer and commit
+ */
+void Database::end_results()
+{
+    this->stop_writer();
+    this->release_statements();
+
+    if (m_writer_error){
+        this->rollback_transaction();
+        std::rethrow_exception(m_writer_error);
+    }
+    this->commit_transaction();
+}
+
+/**
+ * @brief Discard the Batch after a Failure
+ * 
+ * Queued rows are dropped, the statements are released and the
+ * transaction is rolled back, so the connection is closed again.
+ */
+void Database::abort_results()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+        m_queue.clear();
+    }
+    this->stop_writer();
+    this->release_statements();
+
+    if (this->in_transaction()){
+        try {
+            this->rollback_transaction();
+        } catch (std::exception const & exp) {
+            m_logger->database_rollback_failed(exp.what());
+        }
+    }
+}
+
+/**
+ * @brief Let the Writer drain the Queue and wait for it
+ */
+void Database::stop_writer()
+{
+    if (m_writer.joinable()){
+        {
+            std::lock_guard<std::mutex> lock(m_queue_mutex);
+            m_writer_done = true;
+        }
+        m_queue_cv.notify_one();
+        m_writer.join();
+    }
+}
+
+/**
+ * @brief Finalize the Statements of the Batch
+ */
+void Database::release_statements()
+{
+    for (sqlite3_stmt* stmt: {m_insert_macro, m_insert_terminal, m_insert_pin, m_insert_layout, m_insert_results}){
+        if (stmt != nullptr){
+            this->finalize(stmt);
+        }
+    }
+    m_insert_macro = nullptr;
+    m_insert_terminal = nullptr;
+    m_insert_pin = nullptr;
+    m_insert_layout = nullptr;
+    m_insert_results = nullptr;
+}
+
+/**
+ * @brief Write a Row, directly or by the Writer Thread
+ * 
+ * @param row Binds and steps one Statement
+ */
+void Database::submit(std::function<void()> const & row)
+{
+    assertion_check (this->in_transaction());
+
+    if (!m_async){
+        row();
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+        m_queue.push_back(row);
+    }
+    m_queue_cv.notify_one();
+}
+
+/**
+ * @brief Writer Thread, drains the Queue until the Batch ends
+ * 
+ * The first failure is kept and rethrown by end_results.
+ */
+void Database::writer_loop()
+{
+    std::unique_lock<std::mutex> lock(m_queue_mutex);
+
+    while (true){
+        m_queue_cv.wait(lock, [this]{ return !m_queue.empty() || m_writer_done; });
+        if (m_queue.empty()){
+            break;
+        }
+
+        std::deque<std::function<void()>> rows;
+        rows.swap(m_queue);
+        lock.unlock();
+
+        for (std::function<void()> const & row: rows){
+            if (m_writer_error){
+                break;
+            }
+            try {
+                row();
+            } catch (...) {
+                m_writer_error = std::current_exception();
+            }
+        }
+
+        lock.lock();
+    }
 }
 
 /**
@@ -118,34 +316,39 @@ void Database::place_component(size_t const solution, Component* component)
 {
     nullpointer_check (component);
 
-    std::string s    = std::to_string(solution);
     std::string name = component->get_name();
     std::string id   = component->get_id();
-    std::string free = std::to_string(component->is_free());
-    std::string w    = std::to_string(component->get_width_numeral());
-    std::string h    = std::to_string(component->get_height_numeral());
+    size_t free      = component->is_free();
+    size_t w         = component->get_width_numeral();
+    size_t h         = component->get_height_numeral();
 
-    std::string lx;
-    std::string ly;
+    size_t lx = 0;
+    size_t ly = 0;
     std::string o;
 
     if (component->is_free()){
         assertion_check (component->has_solution(solution));
-        lx  = std::to_string(component->get_solution_lx(solution));
-        ly  = std::to_string(component->get_solution_ly(solution));
+        lx  = component->get_solution_lx(solution);
+        ly  = component->get_solution_ly(solution);
         o   = this->orientation_to_string(component->get_solution_orientation(solution));
     } else {
-        lx  = std::to_string(component->get_lx().get_numeral_uint());
-        ly  = std::to_string(component->get_ly().get_numeral_uint());
+        lx  = component->get_lx_numeral();
+        ly  = component->get_ly_numeral();
         o   = "D"; // Default for the Moment -Bookshelf has no Orientation afaik TODO
     }
 
-    std::stringstream query;
-    query << "INSERT INTO macros VALUES (" << s << ",'" << name << "','"
-          << id << "'," << free << ","  << lx << "," << ly << ",'" << o << "',"
-          << w << "," << h << ");";
-
-    this->db_command(query.str());
+    this->submit([=](){
+        this->bind(m_insert_macro, 1, solution);
+        this->bind(m_insert_macro, 2, name);
+        this->bind(m_insert_macro, 3, id);
+        this->bind(m_insert_macro, 4, free);
+        this->bind(m_insert_macro, 5, lx);
+        this->bind(m_insert_macro, 6, ly);
+        this->bind(m_insert_macro, 7, o);
+        this->bind(m_insert_macro, 8, w);
+        this->bind(m_insert_macro, 9, h);
+        this->execute(m_insert_macro);
+    });
 }
 
 /**
@@ -158,25 +361,27 @@ void Database::place_terminal(size_t const solution, Terminal* terminal)
 {
     nullpointer_check (terminal);
 
-    std::string sol = std::to_string(solution);
     std::string name = terminal->get_name();
-    std::string x;
-    std::string y;
+    size_t x = 0;
+    size_t y = 0;
 
     if (terminal->is_free() && terminal->has_solution(solution)){
-        assertion_check(terminal->has_solution(solution));
-        x    = std::to_string(terminal->get_solution_pos_x(solution));
-        y    = std::to_string(terminal->get_solution_pos_y(solution));
+        x = terminal->get_solution_pos_x(solution);
+        y = terminal->get_solution_pos_y(solution);
     } else if (!terminal->is_free()){
-        x = std::to_string(terminal->get_pos_x().get_numeral_uint());
-        y = std::to_string(terminal->get_pos_y().get_numeral_uint());
+        x = terminal->get_pox_x_numerical();
+        y = terminal->get_pos_y_numerical();
     } else {
         return;
     }
-    std::stringstream query;
-    query << "INSERT INTO terminals VALUES (" 
-        << sol << ",'" << name << "'," << x << "," << y << ");";
-    this->db_command(query.str());
+
+    this->submit([=](){
+        this->bind(m_insert_terminal, 1, solution);
+        this->bind(m_insert_terminal, 2, name);
+        this->bind(m_insert_terminal, 3, x);
+        this->bind(m_insert_terminal, 4, y);
+        this->execute(m_insert_terminal);
+    });
 }
 
 /**
@@ -193,7 +398,6 @@ void Database::place_pin(size_t const solution,
     nullpointer_check(parent);
     nullpointer_check(pin);
     
-    std::string sol = std::to_string(solution);
     std::string _parent = parent->get_id();
     std::string name = pin->get_name();
     size_t x = 0;
@@ -209,13 +413,14 @@ void Database::place_pin(size_t const solution,
         return;
     }
 
-    std::stringstream query;
-    query << "INSERT INTO pins VALUES (" << sol << ",'"
-                                         << _parent << "','" 
-                                         << name << "',"
-                                         << x << "," 
-                                         << y << ");";
-    this->db_command(query.str());
+    this->submit([=](){
+        this->bind(m_insert_pin, 1, solution);
+        this->bind(m_insert_pin, 2, _parent);
+        this->bind(m_insert_pin, 3, name);
+        this->bind(m_insert_pin, 4, x);
+        this->bind(m_insert_pin, 5, y);
+        this->execute(m_insert_pin);
+    });
 }
 
 /**
@@ -229,9 +434,12 @@ void Database::insert_results(size_t const solution,
                         size_t const area,
                         size_t const hpwl)
 {
-    std::stringstream query;
-    query << "INSERT INTO results VALUES (" << solution << "," << area << "," << hpwl << ");";
-    this->db_command(query.str());
+    this->submit([=](){
+        this->bind(m_insert_results, 1, solution);
+        this->bind(m_insert_results, 2, area);
+        this->bind(m_insert_results, 3, hpwl);
+        this->execute(m_insert_results);
+    });
 }
 
 /**
@@ -249,33 +457,12 @@ void Database:: insert_layout(size_t const solution,
                               size_t const ux,
                               size_t const uy)
 {
-    std::stringstream query;
-    query << "INSERT INTO layout VALUES ("
-          << solution << ","
-          << lx << "," 
-          << ly << ","
-          << ux << ","
-          << uy << ");";
-    this->db_command(query.str());
-}
-
-/**
- * @brief Export Database Content as CSV File
- * 
- * @param filename Filename to Store to
- */
-void Database::export_as_csv(std::string const & filename)
-{
-    m_logger->export_db_to_csv(filename);
-
-    std::string db = p_db_url;
-    std::string csv = this->get_database_dir() + "/" + filename;
-    std::string script = this->get_db_to_csv_script();
-
-    std::vector<std::string> args;
-    args.push_back(script);
-    args.push_back(db);
-    args.push_back(csv);
-
-    Utils::Utils::system_execute("bash", args, "", false);
+    this->submit([=](){
+        this->bind(m_insert_layout, 1, solution);
+        this->bind(m_insert_layout, 2, lx);
+        this->bind(m_insert_layout, 3, ly);
+        this->bind(m_insert_layout, 4, ux);
+        this->bind(m_insert_layout, 5, uy);
+        this->execute(m_insert_layout);
+    });
 }
@@ -18,11 +18,37 @@
 #include <terminal.hpp>
 #include <logger.hpp>
 
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <exception>
+
 namespace Placer::Utils {
 
 class Database: public virtual Placer::Object,
                 public virtual Placer::Utils::BaseDatabase {
 public:
+    /**
+     * @brief Batch of Results, rolled back unless committed
+     */
+    class ResultsBatch {
+    public:
+        ResultsBatch(Database & db);
+
+        ~ResultsBatch();
+
+        ResultsBatch(ResultsBatch const &) = delete;
+        ResultsBatch& operator= (ResultsBatch const &) = delete;
+
+        void commit();
+
+    private:
+        Database & m_db;
+        bool m_open;
+    };
+
     Database(std::string const & db_file);
 
     virtual ~Database();
@@ -31,6 +57,9 @@ public:
 
     void init_database();
 
+    void begin_results();
+    void end_results();
+
     void place_component(size_t const solution, Component* component);
 
     void place_pin(size_t const solution, Component* parent, Pin* pin);
@@ -47,15 +76,35 @@ public:
                        size_t const ux,
                        size_t const uy);
 
-    void export_as_csv(std::string const & filename);
-
 private:
     Database (Database const & db);
     Database operator= (Database const & db);
     bool operator== (Database const & db);
 
+    void submit(std::function<void()> const & row);
+    void writer_loop();
+    void stop_writer();
+    void release_statements();
+    void abort_results();
+
     Logger* m_logger;
 
+    // Statements of the running Batch
+    sqlite3_stmt* m_insert_macro;
+    sqlite3_stmt* m_insert_terminal;
+    sqlite3_stmt* m_insert_pin;
+    sqlite3_stmt* m_insert_layout;
+    sqlite3_stmt* m_insert_results;
+
+    // Rows are bound and stepped by the Writer if enabled
+    bool m_async;
+    std::thread m_writer;
+    std::mutex m_queue_mutex;
+    std::condition_variable m_queue_cv;
+    std::deque<std::function<void()>> m_queue;
+    bool m_writer_done;
+    std::exception_ptr m_writer_error;
+
     enum db_transaction {
         e_init                      = 0  ///<
     };
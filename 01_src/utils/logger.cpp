@@ -10,28 +10,36 @@
 // Description  : Logger Class
 //==================================================================
 #include "logger.hpp"
+#include <placement_context.hpp>
 
 using namespace Placer;
 using namespace Placer::Utils;
 
 
-Logger* Logger::p_instance = nullptr;
-bool Logger::p_singleton = false;
+std::map<PlacementContext*, Logger*> Logger::p_instances;
+std::mutex Logger::p_instance_mutex;
 
 Logger* Logger::getInstance()
 {
-    if(Logger::p_singleton == false){
-        Logger::p_instance = new Logger();
-        Logger::p_singleton = true;
+    std::lock_guard<std::mutex> lock(Logger::p_instance_mutex);
+
+    Logger*& instance = Logger::p_instances[PlacementContext::current()];
+    if(instance == nullptr){
+        instance = new Logger();
     }
 
-    return p_instance;
+    return instance;
 }
 
 void Logger::destroy()
 {
-    Logger::p_singleton= false;
-    delete Logger::p_instance; Logger::p_instance = nullptr;
+    std::lock_guard<std::mutex> lock(Logger::p_instance_mutex);
+
+    auto itor = Logger::p_instances.find(PlacementContext::current());
+    if (itor != Logger::p_instances.end()){
+        delete itor->second;
+        Logger::p_instances.erase(itor);
+    }
 }
 
 Logger::Logger():
@@ -147,6 +155,14 @@ void Logger::start_encoding()
     LOG(eInfo) << "Start Encoding";
 }
 
+void Logger::encode_non_overlapping_pairs(size_t const encoded, size_t const pruned)
+{
+    std::stringstream msg;
+    msg << "Non-Overlapping Pairs (Encoded: " << encoded << ", Pruned: " << pruned << ")";
+
+    LOG(eInfo) << msg.str();
+}
+
 void Logger::construct_tree(size_t const edges)
 {
     std::stringstream msg;
@@ -161,6 +177,20 @@ void Logger::insert_edge(std::string const & from, std::string const & to)
     LOG(eDebug) << msg.str();
 }
 
+void Logger::merge_edges(size_t const merged, size_t const edges)
+{
+    std::stringstream msg;
+    msg << "Merged " << merged << " parallel Edges, " << edges << " Edges left";
+    LOG(eInfo) << msg.str();
+}
+
+void Logger::skip_cells(size_t const cells, size_t const affinities)
+{
+    std::stringstream msg;
+    msg << "Skip Cells: " << cells << " Cells kept as Records, " << affinities << " Cell Affinities";
+    LOG(eInfo) << msg.str();
+}
+
 void Logger::min_die_area(double const & area)
 {
     std::stringstream msg;
@@ -222,6 +252,24 @@ void Logger::pareto_step()
     LOG(eInfo) << "Next Pareto Optimization Step";
 }
 
+void Logger::push_objective_scope()
+{
+    LOG(eDebug) << "Push Objective Scope";
+}
+
+void Logger::pop_objective_scope()
+{
+    LOG(eDebug) << "Pop Objective Scope";
+}
+
+void Logger::block_solution(size_t const id)
+{
+    std::stringstream msg;
+    msg << "Block Solution " << id << " for Next Optimization Step";
+
+    LOG(eInfo) << msg.str();
+}
+
 void Logger::set_die_ux(size_t const val)
 {
     std::stringstream msg;
@@ -360,6 +408,78 @@ void Logger::run_partitioning()
     LOG(eInfo) << "Partitioning Mode!";
 }
 
+void Logger::solve_partitions(size_t const partitions, size_t const workers)
+{
+    std::stringstream msg;
+    msg << "Solve " << partitions << " Partitions using " << workers << " Threads";
+
+    LOG(eInfo) << msg.str();
+}
+
+void Logger::build_hierarchy(size_t const partitions, size_t const levels)
+{
+    std::stringstream msg;
+    msg << "Partition Hierarchy with " << partitions << " Partitions on " << levels << " Levels";
+
+    LOG(eInfo) << msg.str();
+}
+
+void Logger::solve_hierarchy_level(size_t const level, size_t const partitions)
+{
+    std::stringstream msg;
+    msg << "Solve Hierarchy Level " << level << " (" << partitions << " Partitions)";
+
+    LOG(eInfo) << msg.str();
+}
+
+void Logger::floorplan_cache(size_t const hits, size_t const misses)
+{
+    std::stringstream msg;
+    msg << "Floorplan Cache: " << hits << " Partitions reused, " << misses << " to solve";
+
+    LOG(eInfo) << msg.str();
+}
+
+void Logger::load_snapshot(std::string const & filename)
+{
+    std::stringstream msg;
+    msg << "Loading Design Snapshot (" << filename << ")";
+
+    LOG(eInfo) << msg.str();
+}
+
+void Logger::store_snapshot(std::string const & filename)
+{
+    std::stringstream msg;
+    msg << "Storing Design Snapshot (" << filename << ")";
+
+    LOG(eInfo) << msg.str();
+}
+
+void Logger::load_lef_library(std::string const & lef, std::string const & filename)
+{
+    std::stringstream msg;
+    msg << "Mapping LEF Library " << lef << " (" << filename << ")";
+
+    LOG(eInfo) << msg.str();
+}
+
+void Logger::store_lef_library(std::string const & lef, std::string const & filename)
+{
+    std::stringstream msg;
+    msg << "Storing LEF Library " << lef << " (" << filename << ")";
+
+    LOG(eInfo) << msg.str();
+}
+
+void Logger::encode_hpwl_bounding_box(size_t const nets)
+{
+    std::stringstream msg;
+    msg << "Encode HPWL as Bounding Boxes of " << nets << " Nets";
+
+    LOG(eInfo) << msg.str();
+}
+
 void Logger::encode_int()
 {
     LOG(eInfo) << "Using LIA Theory";
@@ -417,10 +537,10 @@ void Logger::print_version(std::string const & date,
     LOG(eStdOut) << "";
 }
 
-void Logger::export_db_to_csv(std::string const & filename)
+void Logger::export_results(std::string const & filename)
 {
     std::stringstream msg;
-    msg << "Exporting Database to CSV (" << filename << ")";
+    msg << "Exporting Results (" << filename << ")";
 
     LOG(eInfo) << msg.str();
 }
@@ -457,6 +577,14 @@ void Logger::bookshelf_read_nets(std::string const & filename)
     LOG(eInfo) << msg.str();
 }
 
+void Logger::bookshelf_pin_mismatch(size_t const expected, size_t const found)
+{
+    std::stringstream msg;
+    msg << "Bookshelf Nets File states " << expected << " Pins, found " << found;
+
+    LOG(eWarning) << msg.str();
+}
+
 void Logger::bookshelf_read_blocks(std::string const & filename)
 {
     std::stringstream msg;
@@ -603,9 +731,41 @@ void Logger::z3_api_mode()
     LOG(eInfo) << "Invoke Z3 Solver using API";
 }
 
-void Logger::z3_shell_mode()
+void Logger::z3_pool_mode()
 {
-    LOG(eInfo) << "Invoke Z3 Solver using Shell";
+    LOG(eInfo) << "Invoke Z3 Solver using in-process Backend Pool";
+}
+
+void Logger::start_solver_pool(size_t const workers)
+{
+    std::stringstream msg;
+    msg << "Start Solver Pool with " << workers << " Workers";
+
+    LOG(eInfo) << msg.str();
+}
+
+void Logger::solver_pool_winner(std::string const & name)
+{
+    std::stringstream msg;
+    msg << "Solver Pool Winner: " << name;
+
+    LOG(eInfo) << msg.str();
+}
+
+void Logger::solver_pool_best_effort(std::string const & name)
+{
+    std::stringstream msg;
+    msg << "Solver Pool Timeout, using best Model of: " << name;
+
+    LOG(eWarning) << msg.str();
+}
+
+void Logger::database_rollback_failed(std::string const & reason)
+{
+    std::stringstream msg;
+    msg << "Database Rollback failed: " << reason;
+
+    LOG(eError) << msg.str();
 }
 
 void Logger::optimathsat_shell_mode()
@@ -671,3 +831,93 @@ void Logger::invoke_heuristics_lab()
 {
     LOG(eInfo) << "Invoking Remote Heuristics Labs ...";
 }
+
+void Logger::start_batch(size_t const jobs, size_t const workers)
+{
+    std::stringstream msg;
+    msg << "Start Batch with " << jobs << " Jobs using " << workers << " Workers";
+
+    LOG(eInfo) << msg.str();
+}
+
+void Logger::start_batch_job(size_t const id, std::string const & directory)
+{
+    std::stringstream msg;
+    msg << "Start Batch Job " << id << " (" << directory << ")";
+
+    LOG(eInfo) << msg.str();
+}
+
+void Logger::batch_job_finished(size_t const id,
+                                std::string const & directory,
+                                int const status,
+                                size_t const ms)
+{
+    std::stringstream msg;
+    msg << "Batch Job " << id << " (" << directory << ") finished with Status "
+        << status << " after " << ms << " ms";
+
+    if (status == 0){
+        LOG(eInfo) << msg.str();
+    } else {
+        LOG(eWarning) << msg.str();
+    }
+}
+
+void Logger::batch_job_stopped(size_t const id,
+                               std::string const & directory,
+                               int const signal,
+                               size_t const ms)
+{
+    std::stringstream msg;
+    msg << "Batch Job " << id << " (" << directory << ") stopped by Signal "
+        << signal << " after " << ms << " ms";
+
+    LOG(eWarning) << msg.str();
+}
+
+void Logger::batch_job_lost(size_t const id, std::string const & directory)
+{
+    std::stringstream msg;
+    msg << "Batch Job " << id << " (" << directory << ") lost, no Status available";
+
+    LOG(eError) << msg.str();
+}
+
+void Logger::batch_shared_libraries(size_t const libraries)
+{
+    std::stringstream msg;
+    msg << "Batch shares " << libraries << " LEF Libraries with its Jobs";
+
+    LOG(eInfo) << msg.str();
+}
+
+void Logger::batch_library_failed(std::string const & lef, std::string const & reason)
+{
+    std::stringstream msg;
+    msg << "Batch could not share LEF Library " << lef << ": " << reason;
+
+    LOG(eWarning) << msg.str();
+}
+
+void Logger::batch_finished(size_t const jobs, size_t const failed, size_t const stopped)
+{
+    std::stringstream msg;
+    msg << "Batch finished, " << (jobs - failed - stopped) << " of " << jobs << " Jobs succeeded";
+    if (failed != 0){
+        msg << ", " << failed << " failed";
+    }
+    if (stopped != 0){
+        msg << ", " << stopped << " stopped";
+    }
+
+    LOG(eInfo) << msg.str();
+}
+
+void Logger::batch_aborted(std::string const & reason, size_t const running)
+{
+    std::stringstream msg;
+    msg << "Batch aborted (" << reason << "), stopping " << running << " running Jobs";
+
+    LOG(eError) << msg.str();
+}
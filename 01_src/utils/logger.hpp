@@ -15,6 +15,7 @@
 #include <iomanip>
 #include <sstream>
 #include <ctime>
+#include <map>
 
 #include <object.hpp>
 #include <utils.hpp>
@@ -76,7 +77,12 @@ public:
     void invoke_heuristics_lab();
 
     void z3_api_mode();
-    void z3_shell_mode();
+    void z3_pool_mode();
+    void start_solver_pool(size_t const workers);
+    void solver_pool_winner(std::string const & name);
+    void solver_pool_best_effort(std::string const & name);
+
+    void database_rollback_failed(std::string const & reason);
     void optimathsat_shell_mode();
 
     void unsat_solution();
@@ -87,9 +93,12 @@ public:
 
     void start_encoding();
     void end_encoding();
+    void encode_non_overlapping_pairs(size_t const encoded, size_t const pruned);
 
     void construct_tree(size_t const edges);
     void insert_edge(std::string const & from, std::string const & to);
+    void merge_edges(size_t const merged, size_t const edges);
+    void skip_cells(size_t const cells, size_t const affinities);
 
     void min_die_area(double const & area);
     void result_die_area(double const & area);
@@ -105,6 +114,10 @@ public:
     void pareto_solutions(size_t const solutions);
     void pareto_step();
 
+    void push_objective_scope();
+    void pop_objective_scope();
+    void block_solution(size_t const id);
+
     void set_die_ux(size_t const val);
     void set_die_uy(size_t const val);
     void set_die_lx(size_t const val);
@@ -137,7 +150,16 @@ public:
                        size_t const y);
 
     void run_partitioning();
+    void solve_partitions(size_t const partitions, size_t const workers);
+    void build_hierarchy(size_t const partitions, size_t const levels);
+    void solve_hierarchy_level(size_t const level, size_t const partitions);
+    void floorplan_cache(size_t const hits, size_t const misses);
+    void load_snapshot(std::string const & filename);
+    void store_snapshot(std::string const & filename);
+    void load_lef_library(std::string const & lef, std::string const & filename);
+    void store_lef_library(std::string const & lef, std::string const & filename);
     void deduce_layout(size_t const x, size_t const y);
+    void encode_hpwl_bounding_box(size_t const nets);
 
     void add_free_terminal(std::string const & name);
     void add_fixed_terminal(std::string const & name,
@@ -152,7 +174,7 @@ public:
                        size_t const x,
                        size_t const y);
 
-    void export_db_to_csv(std::string const & filename);
+    void export_results(std::string const & filename);
     void export_hypergraph(std::string const & filename);
     void print_header(std::stringstream const & header);
     void print_footer(std::stringstream const & footer);
@@ -163,6 +185,7 @@ public:
 
     void bookshelf_read_aux(std::string const & filename);
     void bookshelf_read_nets(std::string const & filename);
+    void bookshelf_pin_mismatch(size_t const expected, size_t const found);
     void bookshelf_read_blocks(std::string const & filename);
     void bookshelf_read_place(std::string const & filename);
 
@@ -192,12 +215,29 @@ public:
     void start_deserialize();
     void end_deserialize();
 
+    void start_batch(size_t const jobs, size_t const workers);
+    void start_batch_job(size_t const id, std::string const & directory);
+    void batch_job_finished(size_t const id,
+                            std::string const & directory,
+                            int const status,
+                            size_t const ms);
+    void batch_job_stopped(size_t const id,
+                           std::string const & directory,
+                           int const signal,
+                           size_t const ms);
+    void batch_job_lost(size_t const id, std::string const & directory);
+    void batch_shared_libraries(size_t const libraries);
+    void batch_library_failed(std::string const & lef, std::string const & reason);
+    void batch_finished(size_t const jobs, size_t const failed, size_t const stopped);
+    void batch_aborted(std::string const & reason, size_t const running);
+
 private:
     Logger();
     virtual ~Logger();
 
-    static Logger* p_instance;
-    static bool p_singleton;
+    // One Logger per PlacementContext
+    static std::map<PlacementContext*, Logger*> p_instances;
+    static std::mutex p_instance_mutex;
 };
 
 } /* namespace Placer::Utils */
@@ -0,0 +1,114 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : mapped_file.cpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : Read-Only Memory Mapped Input File
+//==================================================================
+#include "mapped_file.hpp"
+
+using namespace Placer::Utils;
+
+/**
+ * @brief Constructor
+ *
+ * @param filename File to map
+ */
+MappedFile::MappedFile(std::string const & filename):
+    m_fd(-1),
+    m_data(nullptr),
+    m_size(0),
+    m_pos(0)
+{
+    m_fd = ::open(filename.c_str(), O_RDONLY);
+    if (m_fd < 0){
+        throw PlacerException("Can not open file (" + filename + ")");
+    }
+
+    struct stat info;
+    if (::fstat(m_fd, &info) != 0){
+        ::close(m_fd);
+        throw PlacerException("Can not stat file (" + filename + ")");
+    }
+    m_size = static_cast<size_t>(info.st_size);
+
+    // Empty files can not be mapped
+    if (m_size == 0){
+        return;
+    }
+
+    void* data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_fd, 0);
+    if (data == MAP_FAILED){
+        ::close(m_fd);
+        throw PlacerException("Can not map file (" + filename + ")");
+    }
+    ::madvise(data, m_size, MADV_SEQUENTIAL);
+
+    m_data = static_cast<char const *>(data);
+}
+
+/**
+ * @brief Destructor
+ */
+MappedFile::~MappedFile()
+{
+    if (m_data != nullptr){
+        ::munmap(const_cast<char*>(m_data), m_size);
+        m_data = nullptr;
+    }
+    if (m_fd >= 0){
+        ::close(m_fd);
+        m_fd = -1;
+    }
+}
+
+/**
+ * @brief Get the whole File Content
+ *
+ * @return std::string_view
+ */
+std::string_view MappedFile::get_content() const
+{
+    return std::string_view(m_data, m_size);
+}
+
+/**
+ * @brief Get the next Line without its Line Break
+ *
+ * DOS line endings are stripped as well.
+ *
+ * @param line View of the Line, valid as long as the File lives
+ * @return bool False if the end of the File has been reached
+ */
+bool MappedFile::next_line(std::string_view & line)
+{
+    if (m_pos >= m_size){
+        return false;
+    }
+
+    std::string_view content = this->get_content();
+    size_t end = content.find('\n', m_pos);
+    if (end == std::string_view::npos){
+        end = m_size;
+    }
+
+    line = content.substr(m_pos, end - m_pos);
+    if (!line.empty() && line.back() == '\r'){
+        line.remove_suffix(1);
+    }
+    m_pos = end + 1;
+
+    return true;
+}
+
+/**
+ * @brief Restart Line Iteration at the Beginning of the File
+ */
+void MappedFile::rewind()
+{
+    m_pos = 0;
+}
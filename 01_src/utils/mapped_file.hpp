@@ -0,0 +1,56 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : mapped_file.hpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : Read-Only Memory Mapped Input File
+//==================================================================
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <string>
+#include <string_view>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <exception.hpp>
+
+namespace Placer::Utils {
+
+/**
+ * @class MappedFile
+ *
+ * @brief Maps a whole input file read-only into memory. Lines are handed
+ *        out as views into the mapping, nothing is copied.
+ */
+class MappedFile {
+public:
+    MappedFile(std::string const & filename);
+
+    ~MappedFile();
+
+    MappedFile(MappedFile const &) = delete;
+    MappedFile& operator= (MappedFile const &) = delete;
+
+    std::string_view get_content() const;
+
+    bool next_line(std::string_view & line);
+    void rewind();
+
+private:
+    int m_fd;
+    char const * m_data;
+    size_t m_size;
+    size_t m_pos;
+};
+
+} /* namespace Placer::Utils */
+
+#endif /* MAPPED_FILE_HPP */
@@ -0,0 +1,336 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : result_exporter.cpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : Export Results as CSV and Binary Column File
+//==================================================================
+#include "result_exporter.hpp"
+
+using namespace Placer;
+using namespace Placer::Utils;
+
+/**
+ * @brief Constructor
+ *
+ * @param components Components to export
+ * @param terminals Terminals to export
+ * @param layout Layout holding the Die of each Solution
+ * @param solutions Number of Solutions
+ */
+ResultExporter::ResultExporter(std::vector<Component*> const & components,
+                               std::vector<Terminal*> const & terminals,
+                               Layout* layout,
+                               size_t const solutions):
+    Object(),
+    m_logger(Logger::getInstance()),
+    m_solution_store(SolutionStore::getInstance()),
+    m_geometry(Geometry::getInstance()),
+    m_components(components),
+    m_terminals(terminals),
+    m_layout(layout),
+    m_solutions(solutions)
+{
+    nullpointer_check (layout);
+}
+
+/**
+ * @brief Destructor
+ */
+ResultExporter::~ResultExporter()
+{
+    m_logger = nullptr;
+}
+
+/**
+ * @brief Write the placed Components of all Solutions as CSV
+ *
+ * @param filename File in the Results Directory
+ */
+void ResultExporter::export_csv(std::string const & filename)
+{
+    m_logger->export_results(filename);
+
+    std::ofstream stream(this->get_database_dir() + filename);
+    if (!stream.is_open()){
+        throw PlacerException("Can not open file (" + filename + ")");
+    }
+
+    stream << "solution,type,id,free,lx,ly,orientation,width,height\n";
+    for (size_t solution = 0; solution < m_solutions; ++solution){
+        for (Component* component: m_components){
+            std::string orientation = "D";
+            if (component->is_free()){
+                if (!component->has_solution(solution)){
+                    continue;
+                }
+                orientation = this->orientation_to_string(component->get_solution_orientation(solution));
+            }
+
+            stream << solution << ","
+                   << csv_field(component->get_name()) << ","
+                   << csv_field(component->get_id()) << ","
+                   << component->is_free() << ","
+                   << this->component_lx(component, solution) << ","
+                   << this->component_ly(component, solution) << ","
+                   << orientation << ","
+                   << component->get_width_numeral() << ","
+                   << component->get_height_numeral() << "\n";
+        }
+    }
+
+    stream.close();
+    if (!stream){
+        throw PlacerException("Can not write file (" + filename + ")");
+    }
+}
+
+/**
+ * @brief Write all Solutions as Binary Column File
+ *
+ * @param filename File in the Results Directory
+ */
+void ResultExporter::export_columns(std::string const & filename)
+{
+    m_logger->export_results(filename);
+
+    std::ofstream stream(this->get_database_dir() + filename, std::ios::binary);
+    if (!stream.is_open()){
+        throw PlacerException("Can not open file (" + filename + ")");
+    }
+
+    // Names of Components followed by Terminals
+    std::vector<uint64_t> offsets(1, 0);
+    std::string names;
+    for (Component* component: m_components){
+        names += component->get_id();
+        offsets.push_back(names.size());
+    }
+    for (Terminal* terminal: m_terminals){
+        names += terminal->get_name();
+        offsets.push_back(names.size());
+    }
+    names.resize((names.size() + 7) & ~size_t(7), '\0');
+
+    uint64_t die_lx = m_layout->is_free_lx() ? s_missing : m_layout->get_lx_numerical();
+    uint64_t die_ly = m_layout->is_free_ly() ? s_missing : m_layout->get_ly_numerical();
+
+    stream.write("SMTPCOL1", 8);
+    this->write_column(stream, {1,
+                                m_components.size(),
+                                m_terminals.size(),
+                                m_solutions,
+                                die_lx,
+                                die_ly,
+                                names.size()});
+    this->write_column(stream, offsets);
+    stream.write(names.data(), names.size());
+
+    std::vector<uint64_t> width, height, free;
+    for (Component* component: m_components){
+        width.push_back(component->get_width_numeral());
+        height.push_back(component->get_height_numeral());
+        free.push_back(component->is_free());
+    }
+    this->write_column(stream, width);
+    this->write_column(stream, height);
+    this->write_column(stream, free);
+
+    std::vector<uint64_t> lx(m_components.size());
+    std::vector<uint64_t> ly(m_components.size());
+    std::vector<uint64_t> orientation(m_components.size());
+    std::vector<uint64_t> x(m_terminals.size());
+    std::vector<uint64_t> y(m_terminals.size());
+
+    for (size_t solution = 0; solution < m_solutions; ++solution){
+        uint64_t die_ux = s_missing;
+        uint64_t die_uy = s_missing;
+        if (!m_layout->is_free_ux()){
+            die_ux = m_layout->get_ux_numercial();
+        } else if (m_layout->has_solution(solution)){
+            die_ux = m_layout->get_solution_ux(solution);
+        }
+        if (!m_layout->is_free_uy()){
+            die_uy = m_layout->get_uy_numerical();
+        } else if (m_layout->has_solution(solution)){
+            die_uy = m_layout->get_solution_uy(solution);
+        }
+        this->write_column(stream, {die_ux, die_uy});
+
+        for (size_t i = 0; i < m_components.size(); ++i){
+            lx[i] = this->component_lx(m_components[i], solution);
+            ly[i] = this->component_ly(m_components[i], solution);
+            orientation[i] = this->component_orientation(m_components[i], solution);
+        }
+        for (size_t i = 0; i < m_terminals.size(); ++i){
+            x[i] = this->terminal_x(m_terminals[i], solution);
+            y[i] = this->terminal_y(m_terminals[i], solution);
+        }
+        this->write_column(stream, lx);
+        this->write_column(stream, ly);
+        this->write_column(stream, orientation);
+        this->write_column(stream, x);
+        this->write_column(stream, y);
+    }
+
+    stream.close();
+    if (!stream){
+        throw PlacerException("Can not write file (" + filename + ")");
+    }
+}
+
+/**
+ * @brief Quote a CSV Field holding a Comma, Quote or Line Break
+ *
+ * @param field Raw Value
+ * @return std::string
+ */
+std::string ResultExporter::csv_field(std::string const & field)
+{
+    if (field.find_first_of(",\"\r\n") == std::string::npos){
+        return field;
+    }
+
+    std::string quoted = "\"";
+    for (char c: field){
+        if (c == '"'){
+            quoted += '"';
+        }
+        quoted += c;
+    }
+    quoted += '"';
+
+    return quoted;
+}
+
+/**
+ * @brief Append a Column to the Stream
+ *
+ * Values are converted to little-endian, on such hosts the column is
+ * written as it is.
+ *
+ * @param stream Binary Output Stream
+ * @param column Values
+ */
+void ResultExporter::write_column(std::ofstream & stream, std::vector<uint64_t> const & column)
+{
+    if (boost::endian::order::native == boost::endian::order::little){
+        stream.write(reinterpret_cast<char const *>(column.data()), column.size() * sizeof(uint64_t));
+        return;
+    }
+
+    std::vector<uint64_t> little(column);
+    for (uint64_t & value: little){
+        boost::endian::native_to_little_inplace(value);
+    }
+    stream.write(reinterpret_cast<char const *>(little.data()), little.size() * sizeof(uint64_t));
+}
+
+/**
+ * @brief LX of a Component in a Solution
+ *
+ * @param component Component
+ * @param solution Solution ID
+ * @return uint64_t
+ */
+uint64_t ResultExporter::component_lx(Component* component, size_t const solution)
+{
+    size_t record = component->get_record();
+
+    if (component->is_free()){
+        if (m_solution_store->get_num_placements(record) <= solution){
+            return s_missing;
+        }
+        return m_solution_store->get_lx(record, solution);
+    }
+
+    return m_geometry->has_lx(record) ? m_geometry->get_lx(record) : s_missing;
+}
+
+/**
+ * @brief LY of a Component in a Solution
+ *
+ * @param component Component
+ * @param solution Solution ID
+ * @return uint64_t
+ */
+uint64_t ResultExporter::component_ly(Component* component, size_t const solution)
+{
+    size_t record = component->get_record();
+
+    if (component->is_free()){
+        if (m_solution_store->get_num_placements(record) <= solution){
+            return s_missing;
+        }
+        return m_solution_store->get_ly(record, solution);
+    }
+
+    return m_geometry->has_ly(record) ? m_geometry->get_ly(record) : s_missing;
+}
+
+/**
+ * @brief Orientation of a Component in a Solution
+ *
+ * @param component Component
+ * @param solution Solution ID
+ * @return uint64_t
+ */
+uint64_t ResultExporter::component_orientation(Component* component, size_t const solution)
+{
+    size_t record = component->get_record();
+
+    if (component->is_free()){
+        if (m_solution_store->get_num_placements(record) <= solution){
+            return s_missing;
+        }
+        return m_solution_store->get_orientation(record, solution);
+    }
+
+    return m_geometry->has_orientation(record) ? static_cast<uint64_t>(m_geometry->get_orientation(record)) : s_missing;
+}
+
+/**
+ * @brief X Position of a Terminal in a Solution
+ *
+ * @param terminal Terminal
+ * @param solution Solution ID
+ * @return uint64_t
+ */
+uint64_t ResultExporter::terminal_x(Terminal* terminal, size_t const solution)
+{
+    size_t record = terminal->get_record();
+
+    if (terminal->is_free()){
+        if (m_solution_store->get_num_placements(record) <= solution){
+            return s_missing;
+        }
+        return m_solution_store->get_lx(record, solution);
+    }
+
+    return m_geometry->get_lx(record);
+}
+
+/**
+ * @brief Y Position of a Terminal in a Solution
+ *
+ * @param terminal Terminal
+ * @param solution Solution ID
+ * @return uint64_t
+ */
+uint64_t ResultExporter::terminal_y(Terminal* terminal, size_t const solution)
+{
+    size_t record = terminal->get_record();
+
+    if (terminal->is_free()){
+        if (m_solution_store->get_num_placements(record) <= solution){
+            return s_missing;
+        }
+        return m_solution_store->get_ly(record, solution);
+    }
+
+    return m_geometry->get_ly(record);
+}
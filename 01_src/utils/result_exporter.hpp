@@ -0,0 +1,89 @@
+//==================================================================
+// Author       : Pointner Sebastian
+// Company      : Johannes Kepler University
+// Name         : SMT Macro Placer
+// Workfile     : result_exporter.hpp
+//
+// Date         : 17. October 2026
+// Compiler     : gcc version 10.1.0 (GCC)
+// Copyright    : Johannes Kepler University
+// Description  : Export Results as CSV and Binary Column File
+//==================================================================
+#ifndef RESULT_EXPORTER_HPP
+#define RESULT_EXPORTER_HPP
+
+#include <object.hpp>
+#include <component.hpp>
+#include <terminal.hpp>
+#include <layout.hpp>
+#include <solution_store.hpp>
+#include <geometry.hpp>
+#include <logger.hpp>
+#include <exception.hpp>
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstdint>
+#include <limits>
+
+#include <boost/endian/conversion.hpp>
+
+namespace Placer::Utils {
+
+/**
+ * @class ResultExporter
+ *
+ * @brief Streams the solutions of the SolutionStore to files, no database
+ *        or external tool is involved.
+ *
+ * The CSV file matches the macros table of the results database, names
+ * holding a comma, quote or line break are quoted as in RFC 4180.
+ *
+ * The column file is little-endian, every field is a uint64 so the whole
+ * file can be mapped and read as an array:
+ *   magic "SMTPCOL1", version, components C, terminals T, solutions S,
+ *   die lx, die ly, size of the name block in bytes
+ *   name offsets [C + T + 1], name bytes padded to 8
+ *   width [C], height [C], free [C]
+ *   per solution: die ux, die uy, lx [C], ly [C], orientation [C],
+ *                 terminal x [T], terminal y [T]
+ * Values without a solution are stored as UINT64_MAX.
+ */
+class ResultExporter: public virtual Placer::Object {
+public:
+    ResultExporter(std::vector<Component*> const & components,
+                   std::vector<Terminal*> const & terminals,
+                   Layout* layout,
+                   size_t const solutions);
+
+    virtual ~ResultExporter();
+
+    void export_csv(std::string const & filename);
+    void export_columns(std::string const & filename);
+
+    static constexpr uint64_t s_missing = std::numeric_limits<uint64_t>::max();
+
+private:
+    static std::string csv_field(std::string const & field);
+    void write_column(std::ofstream & stream, std::vector<uint64_t> const & column);
+
+    uint64_t component_lx(Component* component, size_t const solution);
+    uint64_t component_ly(Component* component, size_t const solution);
+    uint64_t component_orientation(Component* component, size_t const solution);
+    uint64_t terminal_x(Terminal* terminal, size_t const solution);
+    uint64_t terminal_y(Terminal* terminal, size_t const solution);
+
+    Logger* m_logger;
+    SolutionStore* m_solution_store;
+    Geometry* m_geometry;
+
+    std::vector<Component*> m_components;
+    std::vector<Terminal*> m_terminals;
+    Layout* m_layout;
+    size_t m_solutions;
+};
+
+} /* namespace Placer::Utils */
+
+#endif /* RESULT_EXPORTER_HPP */
@@ -10,6 +10,7 @@
 // Description  : Utility Class
 //==================================================================
 #include "utils.hpp"
+#include "exception.hpp"
 
 using namespace Placer::Utils;
 
@@ -44,6 +45,101 @@ std::vector<std::string> Utils::tokenize(std::string const & str, std::string co
     return tokens;
 }
 
+/**
+ * @brief Split a string into views separated by a given delimiter
+ * 
+ * The views point into str, tokens is cleared and refilled so its
+ * storage can be reused line by line.
+ * 
+ * @param str: The string to tokenize
+ * @param delimiters: The delimiter to split the string
+ * @param tokens: The found token
+ */
+void Utils::tokenize(std::string_view const & str,
+                     std::string_view const & delimiters,
+                     std::vector<std::string_view> & tokens)
+{
+    tokens.clear();
+
+    size_t lastPos = str.find_first_not_of(delimiters, 0);
+    while (lastPos != std::string_view::npos){
+        size_t pos = str.find_first_of(delimiters, lastPos);
+        if (pos == std::string_view::npos){
+            tokens.push_back(str.substr(lastPos));
+            break;
+        }
+        tokens.push_back(str.substr(lastPos, pos - lastPos));
+        lastPos = str.find_first_not_of(delimiters, pos);
+    }
+}
+
+/**
+ * @brief Parse the leading unsigned number of a string
+ * 
+ * Like std::stoi, leading white spaces are skipped and trailing
+ * characters are ignored.
+ * 
+ * @param str: The string to parse
+ * @return size_t
+ */
+size_t Utils::to_size(std::string_view const & str)
+{
+    size_t begin = str.find_first_not_of(" \t");
+    if (begin == std::string_view::npos){
+        throw PlacerException("Expected number, got empty string");
+    }
+
+    size_t value = 0;
+    std::from_chars_result result = std::from_chars(str.data() + begin,
+                                                    str.data() + str.size(),
+                                                    value);
+    if (result.ec != std::errc()){
+        throw PlacerException("Expected number, got " + std::string(str));
+    }
+
+    return value;
+}
+
+/**
+ * @brief 64 Bit FNV-1a Hash
+ * 
+ * Unlike std::hash the value is specified, it may name files that
+ * outlive the run and the standard library.
+ * 
+ * @param data: The bytes to hash
+ * @return uint64_t
+ */
+uint64_t Utils::fnv1a(std::string_view const & data)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for (char c: data){
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief FNV-1a Hash as fixed Width Hex String, e.g. for Cache Files
+ * 
+ * @param data: The bytes to hash
+ * @return std::string
+ */
+std::string Utils::digest(std::string_view const & data)
+{
+    static char const hex[] = "0123456789abcdef";
+
+    uint64_t hash = fnv1a(data);
+    std::string result(16, '0');
+    for (size_t i = 16; i > 0; --i){
+        result[i - 1] = hex[hash & 0xf];
+        hash >>= 4;
+    }
+
+    return result;
+}
+
 /**
  * @brief Execute a Tool on the Host System
  * 
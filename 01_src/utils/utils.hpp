@@ -13,6 +13,9 @@
 #define UTILS_HPP
 
 #include <string>
+#include <string_view>
+#include <charconv>
+#include <cstdint>
 #include <vector>
 #include <fstream>
 #include <chrono>
@@ -42,6 +45,16 @@ public:
     static std::vector<std::string> tokenize(std::string const & str,
                                              std::string const & delimiters);
 
+    static void tokenize(std::string_view const & str,
+                         std::string_view const & delimiters,
+                         std::vector<std::string_view> & tokens);
+
+    static size_t to_size(std::string_view const & str);
+
+    static uint64_t fnv1a(std::string_view const & data);
+
+    static std::string digest(std::string_view const & data);
+
     static std::string get_bash_string_blink_red(std::string const & str);
 
     static std::string get_bash_string_cyan(std::string const & str);